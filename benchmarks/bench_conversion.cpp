@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+#include "common.hpp"
+#include "roofline.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+namespace nf = FoamAdapter;
+
+#include "fvc.H"
+
+// The conversion paths between OpenFOAM and NeoN are memory bound, hence every benchmark
+// records the bytes it moves, ie. the bytes read from the source plus the bytes written to the
+// destination.
+
+/* bytes of the internal and boundary values of an OpenFOAM field */
+template<typename FoamType>
+std::size_t foamBytes(const FoamType& field)
+{
+    using primitive_t = typename FoamType::value_type;
+    std::size_t nValues = field.size();
+    forAll(field.boundaryField(), patchi)
+    {
+        nValues += field.boundaryField()[patchi].size();
+    }
+    return nValues * sizeof(primitive_t);
+}
+
+
+TEST_CASE("readOpenFOAMMesh")
+{
+    Foam::Time& runTime = *timePtr;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+    Foam::fvMesh& mesh = *meshPtr;
+
+    // the OpenFOAM mesh holds the same geometry in the same precision
+    const std::size_t bytes = 2 * nf::memoryUsage(nf::readOpenFOAMMesh(exec, mesh));
+    recordModel("readOpenFOAMMesh", execName, execName, exec, {.bytes = bytes});
+
+    BENCHMARK(std::string(execName))
+    {
+        auto nfMesh = nf::readOpenFOAMMesh(exec, mesh);
+        Kokkos::fence();
+        return nfMesh.nCells();
+    };
+}
+
+
+TEST_CASE("constructFrom")
+{
+    Foam::Time& runTime = *timePtr;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::unique_ptr<nf::MeshAdapter> meshPtr = nf::createMesh(exec, runTime);
+    nf::MeshAdapter& mesh = *meshPtr;
+    const auto& nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh, "T");
+    auto ofU = readField<Foam::volVectorField>(runTime, mesh, "U");
+
+    SECTION("scalar")
+    {
+        const std::size_t bytes =
+            foamBytes(ofT) + nf::memoryUsage(nf::constructFrom(exec, nfMesh, ofT));
+        recordModel("constructFrom", execName + "/scalar", execName, exec, {.bytes = bytes});
+
+        BENCHMARK(std::string(execName + "/scalar"))
+        {
+            auto nfT = nf::constructFrom(exec, nfMesh, ofT);
+            Kokkos::fence();
+            return nfT.internalVector().size();
+        };
+    }
+
+    SECTION("vector")
+    {
+        const std::size_t bytes =
+            foamBytes(ofU) + nf::memoryUsage(nf::constructFrom(exec, nfMesh, ofU));
+        recordModel("constructFrom", execName + "/vector", execName, exec, {.bytes = bytes});
+
+        BENCHMARK(std::string(execName + "/vector"))
+        {
+            auto nfU = nf::constructFrom(exec, nfMesh, ofU);
+            Kokkos::fence();
+            return nfU.internalVector().size();
+        };
+    }
+}
+
+
+TEST_CASE("constructSurfaceField")
+{
+    Foam::Time& runTime = *timePtr;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::unique_ptr<nf::MeshAdapter> meshPtr = nf::createMesh(exec, runTime);
+    nf::MeshAdapter& mesh = *meshPtr;
+    const auto& nfMesh = mesh.nfMesh();
+
+    auto ofU = readField<Foam::volVectorField>(runTime, mesh, "U");
+    Foam::surfaceScalarField ofPhi("phi", Foam::fvc::flux(ofU));
+
+    auto nfPhi = nf::constructSurfaceField(exec, nfMesh, ofPhi);
+    const std::size_t bytes = foamBytes(ofPhi) + nf::memoryUsage(nfPhi.internalVector())
+                            + nf::memoryUsage(nfPhi.boundaryData().value());
+    recordModel("constructSurfaceField", execName, execName, exec, {.bytes = bytes});
+
+    BENCHMARK(std::string(execName))
+    {
+        auto nfPhi = nf::constructSurfaceField(exec, nfMesh, ofPhi);
+        Kokkos::fence();
+        return nfPhi.internalVector().size();
+    };
+}
+
+
+TEST_CASE("readVolBoundaryConditions")
+{
+    Foam::Time& runTime = *timePtr;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::unique_ptr<nf::MeshAdapter> meshPtr = nf::createMesh(exec, runTime);
+    nf::MeshAdapter& mesh = *meshPtr;
+    const auto& nfMesh = mesh.nfMesh();
+
+    auto ofU = readField<Foam::volVectorField>(runTime, mesh, "U");
+
+    // only the boundary values are moved
+    const std::size_t bytes = 2 * (foamBytes(ofU) - ofU.size() * sizeof(Foam::vector));
+    recordModel("readVolBoundaryConditions", execName, execName, exec, {.bytes = bytes});
+
+    BENCHMARK(std::string(execName))
+    {
+        auto bcs = nf::readVolBoundaryConditions(nfMesh, ofU);
+        Kokkos::fence();
+        return bcs.size();
+    };
+}
+
+
+TEST_CASE("convertDictionary")
+{
+    Foam::Time& runTime = *timePtr;
+
+    std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+    Foam::fvMesh& mesh = *meshPtr;
+    const Foam::dictionary& fvSolution = mesh.solutionDict();
+    const Foam::dictionary& fvSchemes = mesh.schemesDict();
+
+    // the dictionaries are converted on the host, their size is taken as written to disk
+    Foam::OStringStream os;
+    fvSolution.write(os, false);
+    fvSchemes.write(os, false);
+    const std::size_t bytes = 2 * os.str().size();
+    recordModel(
+        "convertDictionary",
+        "host",
+        "SerialExecutor",
+        NeoN::SerialExecutor {},
+        {.bytes = bytes}
+    );
+
+    BENCHMARK(std::string("host"))
+    {
+        auto solution = nf::convert(fvSolution);
+        auto schemes = nf::convert(fvSchemes);
+        return solution.keys().size() + schemes.keys().size();
+    };
+}
+
+
+TEST_CASE("write")
+{
+    Foam::Time& runTime = *timePtr;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::unique_ptr<nf::MeshAdapter> meshPtr = nf::createMesh(exec, runTime);
+    nf::MeshAdapter& mesh = *meshPtr;
+    const auto& nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh, "T");
+    auto ofU = readField<Foam::volVectorField>(runTime, mesh, "U");
+    auto nfT = nf::constructFrom(exec, nfMesh, ofT);
+    auto nfU = nf::constructFrom(exec, nfMesh, ofU);
+
+    // the values are copied to the host and converted into an OpenFOAM field before writing
+    SECTION("scalarVector")
+    {
+        recordModel(
+            "write",
+            execName + "/scalarVector",
+            execName,
+            exec,
+            {.bytes = 2 * nf::memoryUsage(nfT.internalVector())}
+        );
+
+        BENCHMARK(std::string(execName + "/scalarVector"))
+        {
+            nf::write(nfT.internalVector(), mesh, "nfT");
+            return;
+        };
+    }
+
+    SECTION("vectorVector")
+    {
+        recordModel(
+            "write",
+            execName + "/vectorVector",
+            execName,
+            exec,
+            {.bytes = 2 * nf::memoryUsage(nfU.internalVector())}
+        );
+
+        BENCHMARK(std::string(execName + "/vectorVector"))
+        {
+            nf::write(nfU.internalVector(), mesh, "nfU");
+            return;
+        };
+    }
+
+    SECTION("scalarVolumeField")
+    {
+        recordModel(
+            "write",
+            execName + "/scalarVolumeField",
+            execName,
+            exec,
+            {.bytes = 2 * foamBytes(ofT)}
+        );
+
+        BENCHMARK(std::string(execName + "/scalarVolumeField"))
+        {
+            nf::write(nfT, mesh, "nfT");
+            return;
+        };
+    }
+
+    SECTION("vectorVolumeField")
+    {
+        recordModel(
+            "write",
+            execName + "/vectorVolumeField",
+            execName,
+            exec,
+            {.bytes = 2 * foamBytes(ofU)}
+        );
+
+        BENCHMARK(std::string(execName + "/vectorVolumeField"))
+        {
+            nf::write(nfU, mesh, "nfU");
+            return;
+        };
+    }
+}
@@ -19,14 +19,12 @@ namespace dsl = NeoN::dsl;
 #include "fvm.H"
 #include "fvMatrices.H"
 
-TEST_CASE("advection–diffusion-equation_scalar")
+/* the transported scalar, a face flux and a diffusivity as used by both paths */
+auto constructOfFields(const Foam::Time& runTime, const Foam::fvMesh& mesh)
 {
-    Foam::Time& runTime = *timePtr;
-    Foam::fvMesh& mesh = *meshPtr;
-
     auto ofT = randomScalarField(runTime, mesh, "T");
     Foam::surfaceScalarField ofPhi(
-        Foam::IOobject("phi", "0", mesh, Foam::IOobject::NO_READ, Foam::IOobject::AUTO_WRITE),
+        Foam::IOobject("phi", "0", mesh, Foam::IOobject::NO_READ, Foam::IOobject::NO_WRITE),
         mesh,
         Foam::dimensionedScalar("phi", Foam::dimensionSet(0, 3, -1, 0, 0), 0.0)
     );
@@ -36,25 +34,73 @@ TEST_CASE("advection–diffusion-equation_scalar")
     }
 
     Foam::surfaceScalarField ofGamma(
-        Foam::IOobject("Gamma", "0", mesh, Foam::IOobject::NO_READ, Foam::IOobject::AUTO_WRITE),
+        Foam::IOobject("Gamma", "0", mesh, Foam::IOobject::NO_READ, Foam::IOobject::NO_WRITE),
         mesh,
-        Foam::dimensionedScalar("phi", Foam::dimensionSet(0, 2, -1, 0, 0), 0.0)
+        Foam::dimensionedScalar("Gamma", Foam::dimensionSet(0, 2, -1, 0, 0), 1.0)
     );
+    return std::make_tuple(std::move(ofT), std::move(ofPhi), std::move(ofGamma));
+}
+
+/* inserts the schemes of the advection diffusion equation with the given time scheme */
+void insertSchemes(FoamAdapter::RunTime& rt, const std::string& ddtScheme)
+{
+    rt.fvSchemesDict.insert(
+        std::string("ddtSchemes"),
+        NeoN::Dictionary({{std::string("type"), NeoN::TokenList({ddtScheme})}})
+    );
+    rt.fvSchemesDict.insert(
+        std::string("divSchemes"),
+        NeoN::Dictionary(
+            {{std::string("div(phi,nfT)"),
+              NeoN::TokenList({std::string("Gauss"), std::string("upwind")})}}
+        )
+    );
+    rt.fvSchemesDict.insert(
+        std::string("laplacianSchemes"),
+        NeoN::Dictionary(
+            {{std::string("laplacian(Gamma,nfT)"),
+              NeoN::TokenList(
+                  {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+              )}}
+        )
+    );
+}
+
+// The OpenFOAM benchmark constructs a fvScalarMatrix, which includes assembling the
+// coefficients. The NeoN benchmark named by the executor does the same with a PDESolver, its
+// phases are timed separately as executor/phase:
+// - construct: building the expression and the PDESolver, which allocates the linear system
+// - assemble: assembling into the preallocated linear system
+// - solve: solving the assembled system
+// Both paths solve with PBiCGStab, as upwinding renders the matrix asymmetric.
+
+TEST_CASE("advection–diffusion-equation_scalar")
+{
+    Foam::Time& runTime = *timePtr;
+
+    Foam::dictionary solverControls;
+    solverControls.add("solver", "PBiCGStab");
+    solverControls.add("preconditioner", "DILU");
+    solverControls.add("tolerance", 0.0);
+    solverControls.add("relTol", 1e-6);
+    solverControls.add("maxIter", 1000);
 
     SECTION("OpenFOAM")
     {
-        auto [ofT, ofPhi, ofGamma] = constructOfFields(mesh);
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+        auto [ofT, ofPhi, ofGamma] = constructOfFields(runTime, mesh);
+        const Foam::scalarField T0(ofT.primitiveField());
 
         SECTION("explicit-time-integration")
         {
-
             BENCHMARK(std::string("OpenFOAM"))
             {
                 Foam::fvScalarMatrix advectDiffEqn(
                     Foam::fvm::ddt(ofT) + Foam::fvc::div(ofPhi, ofT)
                     - Foam::fvc::laplacian(ofGamma, ofT)
                 );
-                return advectDiffEqn;
+                return advectDiffEqn.diag()[0];
             };
         }
 
@@ -66,7 +112,18 @@ TEST_CASE("advection–diffusion-equation_scalar")
                     Foam::fvm::ddt(ofT) + Foam::fvm::div(ofPhi, ofT)
                     - Foam::fvm::laplacian(ofGamma, ofT)
                 );
-                return advectDiffEqn;
+                return advectDiffEqn.diag()[0];
+            };
+
+            Foam::fvScalarMatrix advectDiffEqn(
+                Foam::fvm::ddt(ofT) + Foam::fvm::div(ofPhi, ofT)
+                - Foam::fvm::laplacian(ofGamma, ofT)
+            );
+
+            BENCHMARK(std::string("OpenFOAM/solve"))
+            {
+                ofT.primitiveFieldRef() = T0;
+                return advectDiffEqn.solve(solverControls).nIterations();
             };
         }
     }
@@ -75,16 +132,17 @@ TEST_CASE("advection–diffusion-equation_scalar")
     SECTION("NeoN")
     {
         auto [execName, exec] = GENERATE(allAvailableExecutor());
-        auto [ofT, ofPhi, ofGamma] = constructOfFields(mesh);
 
-        auto rt = nf::createAdapterRunTime(runTime);
+        auto rt = nf::createAdapterRunTime(runTime, exec);
+        auto& mesh = rt.mesh;
+        auto [ofT, ofPhi, ofGamma] = constructOfFields(runTime, mesh);
 
         auto& vectorCollection = fvcc::VectorCollection::instance(rt.db, "VectorCollection");
         fvcc::VolumeField<NeoN::scalar>& nfT =
             vectorCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
                 nf::CreateFromFoamField<Foam::volScalarField> {
-                    .exec = exec,
-                    .nfMesh = nfMesh,
+                    .exec = rt.exec,
+                    .nfMesh = rt.nfMesh,
                     .foamField = ofT,
                     .name = "nfT"
                 }
@@ -93,85 +151,116 @@ TEST_CASE("advection–diffusion-equation_scalar")
 
         auto& nfOldT = fvcc::oldTime(nfT);
         nfOldT.internalVector() = nfT.internalVector();
+        const NeoN::Vector<NeoN::scalar> T0(nfT.internalVector());
 
         auto nfPhi = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofPhi);
         auto nfGamma = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofGamma);
 
+        auto& solverDict = rt.fvSolutionDict.get<NeoN::Dictionary>("solvers");
+        solverDict.insert(
+            std::string("nfT"),
+            nf::mapFvSolution(NeoN::Dictionary(
+                {{std::string("solver"), std::string("PBiCGStab")},
+                 {std::string("preconditioner"), std::string("DILU")},
+                 {std::string("relTol"), NeoN::scalar(1e-6)},
+                 {std::string("maxIter"), NeoN::label(1000)}}
+            ))
+        );
+
         SECTION(std::string("explicit-time-integration"))
         {
-            rt.fvSchemesDict.insert(
-                std::string("ddtSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("type"), NeoN::TokenList({std::string("forwardEuler")})}}
-                )
-            );
-            rt.fvSchemesExpDict.insert(
-                std::string("divSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("div(phi,nfT)"),
-                      NeoN::TokenList({std::string("Gauss"), std::string("upwind")})}}
-                )
-            );
-            rt.fvSchemesExpDict.insert(
-                std::string("laplacianSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("laplacian(Gamma,nfT)"),
-                      NeoN::TokenList(
-                          {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
-                      )}}
-                )
-            );
+            insertSchemes(rt, "forwardEuler");
 
             BENCHMARK(std::string(execName))
             {
-                // Momentum predictor
-                nffvcc::Expression<NeoN::scalar> advectDiffEqn(
+                nf::PDESolver<NeoN::scalar> advectDiffEqn(
                     dsl::imp::ddt(nfT) + dsl::exp::div(nfPhi, nfT)
                         - dsl::exp::laplacian(nfGamma, nfT),
                     nfT,
                     rt
                 );
                 advectDiffEqn.assemble();
+                Kokkos::fence();
+                return;
+            };
+
+            BENCHMARK(std::string(execName + "/construct"))
+            {
+                nf::PDESolver<NeoN::scalar> advectDiffEqn(
+                    dsl::imp::ddt(nfT) + dsl::exp::div(nfPhi, nfT)
+                        - dsl::exp::laplacian(nfGamma, nfT),
+                    nfT,
+                    rt
+                );
+                Kokkos::fence();
+                return advectDiffEqn.linearSystem().rhs().size();
+            };
+
+            nf::PDESolver<NeoN::scalar> advectDiffEqn(
+                dsl::imp::ddt(nfT) + dsl::exp::div(nfPhi, nfT) - dsl::exp::laplacian(nfGamma, nfT),
+                nfT,
+                rt
+            );
+
+            BENCHMARK(std::string(execName + "/assemble"))
+            {
+                advectDiffEqn.assemble();
+                Kokkos::fence();
                 return;
             };
         }
 
         SECTION(std::string("implicit-time-integration"))
         {
-            rt.fvSchemesDict.insert(
-                std::string("ddtSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("type"), NeoN::TokenList({std::string("backwardEuler")})}}
-                )
-            );
-            rt.fvSchemesDict.insert(
-                std::string("divSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("div(phi,nfT)"),
-                      NeoN::TokenList({std::string("Gauss"), std::string("upwind")})}}
-                )
-            );
-            rt.fvSchemesDict.insert(
-                std::string("laplacianSchemes"),
-                NeoN::Dictionary(
-                    {{std::string("laplacian(Gamma,nfT)"),
-                      NeoN::TokenList(
-                          {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
-                      )}}
-                )
-            );
+            insertSchemes(rt, "backwardEuler");
 
             BENCHMARK(std::string(execName))
             {
-                // Momentum predictor
-                nf::Expression<NeoN::scalar> advectDiffEqn(
+                nf::PDESolver<NeoN::scalar> advectDiffEqn(
+                    dsl::imp::ddt(nfT) + dsl::imp::div(nfPhi, nfT)
+                        - dsl::imp::laplacian(nfGamma, nfT),
+                    nfT,
+                    rt
+                );
+                advectDiffEqn.assemble();
+                Kokkos::fence();
+                return;
+            };
+
+            BENCHMARK(std::string(execName + "/construct"))
+            {
+                nf::PDESolver<NeoN::scalar> advectDiffEqn(
                     dsl::imp::ddt(nfT) + dsl::imp::div(nfPhi, nfT)
                         - dsl::imp::laplacian(nfGamma, nfT),
                     nfT,
                     rt
                 );
-                auto ls = advectDiffEqn.assemble();
-                return ls;
+                Kokkos::fence();
+                return advectDiffEqn.linearSystem().rhs().size();
+            };
+
+            nf::PDESolver<NeoN::scalar> advectDiffEqn(
+                dsl::imp::ddt(nfT) + dsl::imp::div(nfPhi, nfT) - dsl::imp::laplacian(nfGamma, nfT),
+                nfT,
+                rt
+            );
+
+            BENCHMARK(std::string(execName + "/assemble"))
+            {
+                advectDiffEqn.assemble();
+                Kokkos::fence();
+                return;
+            };
+
+            advectDiffEqn.assemble();
+
+            BENCHMARK(std::string(execName + "/solve"))
+            {
+                nfT.internalVector() = T0;
+                auto stats = NeoN::la::Solver(exec, solverDict.get<NeoN::Dictionary>("nfT"))
+                                 .solve(advectDiffEqn.linearSystem(), nfT.internalVector());
+                Kokkos::fence();
+                return stats.numIter;
             };
         }
     }
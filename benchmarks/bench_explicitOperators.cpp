@@ -8,6 +8,7 @@
 #include "benchmarks/catch_main.hpp"
 #include "test/catch2/executorGenerator.hpp"
 #include "common.hpp"
+#include "roofline.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 namespace dsl = NeoN::dsl;
@@ -89,6 +90,14 @@ TEST_CASE("DivOperator")
 
         auto nfPhi = FoamAdapter::constructSurfaceField(exec, nfMesh, ofPhi);
 
+        recordModel(
+            "DivOperator",
+            execName,
+            execName,
+            exec,
+            roofline::explicitDiv<NeoN::scalar>(nfMesh)
+        );
+
         SECTION("with Allocation")
         {
             NeoN::TokenList scheme({std::string("linear")});
@@ -187,6 +196,14 @@ TEST_CASE("LaplacianOperator")
 
         auto nfGamma = FoamAdapter::constructSurfaceField(exec, nfMesh, ofGamma);
 
+        recordModel(
+            "LaplacianOperator",
+            execName,
+            execName,
+            exec,
+            roofline::explicitLaplacian<NeoN::scalar>(nfMesh)
+        );
+
         SECTION("with Allocation")
         {
             NeoN::TokenList scheme({std::string("linear"), std::string("uncorrected")});
@@ -289,11 +306,114 @@ TEST_CASE("GradOperator")
             };
         }
 
+        SECTION("SoA")
+        {
+            nfT.correctBoundaryConditions();
+            FoamAdapter::SoAVolumeField nfGradT(nfMesh, "gradT");
+            // the face geometry is created on first use
+            mesh.soaFaceGeometry();
+
+            BENCHMARK(std::string(execName))
+            {
+                FoamAdapter::gaussGreenGrad(nfT, mesh, nfGradT);
+                if (execName == "GPUExecutor")
+                {
+                    Kokkos::fence();
+                }
+                return;
+            };
+        }
+
         // TODO: dsl
     }
 }
 
 
+TEST_CASE("FluxOperator")
+{
+    Foam::Time& runTime = *timePtr;
+
+    SECTION("OpenFOAM")
+    {
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+
+        auto ofU = randomVectorField(runTime, mesh, "U");
+
+        SECTION("with Allocation")
+        {
+            BENCHMARK(std::string("OpenFOAM"))
+            {
+                Foam::surfaceScalarField ofPhi("ofPhi", Foam::fvc::flux(ofU));
+                return;
+            };
+        }
+    }
+
+
+    SECTION("NeoN")
+    {
+        auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+        std::unique_ptr<FoamAdapter::MeshAdapter> meshPtr = FoamAdapter::createMesh(exec, runTime);
+        FoamAdapter::MeshAdapter& mesh = *meshPtr;
+        const auto& nfMesh = mesh.nfMesh();
+
+        auto ofU = randomVectorField(runTime, mesh, "U");
+
+        recordModel("FluxOperator", execName, execName, exec, roofline::flux(nfMesh));
+
+        SECTION("with Allocation")
+        {
+            auto nfU = FoamAdapter::constructFrom(exec, nfMesh, ofU);
+
+            BENCHMARK(std::string(execName))
+            {
+                auto nfPhi = FoamAdapter::flux(nfU, mesh);
+                if (execName == "GPUExecutor")
+                {
+                    Kokkos::fence();
+                }
+                return;
+            };
+        }
+
+        SECTION("SoA")
+        {
+            auto nfU = FoamAdapter::constructSoAFrom(exec, nfMesh, ofU);
+            mesh.soaFaceGeometry();
+
+            BENCHMARK(std::string(execName))
+            {
+                auto nfPhi = FoamAdapter::flux(nfU, mesh);
+                if (execName == "GPUExecutor")
+                {
+                    Kokkos::fence();
+                }
+                return;
+            };
+        }
+
+        SECTION("SoA single precision geometry")
+        {
+            auto nfU = FoamAdapter::constructSoAFrom(exec, nfMesh, ofU);
+            mesh.setSinglePrecisionGeometry(true);
+            mesh.singlePrecisionFaceGeometry();
+
+            BENCHMARK(std::string(execName))
+            {
+                auto nfPhi = FoamAdapter::flux(nfU, mesh);
+                if (execName == "GPUExecutor")
+                {
+                    Kokkos::fence();
+                }
+                return;
+            };
+        }
+    }
+}
+
+
 TEST_CASE("FaceInterpolation")
 {
     Foam::Time& runTime = *timePtr;
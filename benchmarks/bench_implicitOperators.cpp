@@ -8,6 +8,7 @@
 #include "benchmarks/catch_main.hpp"
 #include "test/catch2/executorGenerator.hpp"
 #include "common.hpp"
+#include "roofline.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 namespace dsl = NeoN::dsl;
@@ -89,6 +90,14 @@ TEST_CASE("DivOperator")
 
         auto nfPhi = FoamAdapter::constructSurfaceField(exec, nfMesh, ofPhi);
 
+        recordModel(
+            "DivOperator",
+            execName,
+            execName,
+            exec,
+            roofline::implicitDiv<NeoN::scalar>(nfMesh)
+        );
+
         SECTION("with Allocation")
         {
             NeoN::TokenList scheme({std::string("linear")});
@@ -193,6 +202,14 @@ TEST_CASE("LaplacianOperator")
 
         auto nfGamma = FoamAdapter::constructSurfaceField(exec, nfMesh, ofGamma);
 
+        recordModel(
+            "LaplacianOperator",
+            execName,
+            execName,
+            exec,
+            roofline::implicitLaplacian<NeoN::scalar>(nfMesh)
+        );
+
         SECTION("with Allocation")
         {
             NeoN::TokenList scheme({std::string("linear"), std::string("uncorrected")});
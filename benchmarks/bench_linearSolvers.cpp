@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+#include "common.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+namespace dsl = NeoN::dsl;
+
+#include "fv.H"
+#include "fvc.H"
+#include "fvm.H"
+
+
+TEST_CASE("LaplacianSolve")
+{
+    Foam::Time& runTime = *timePtr;
+    Foam::argList& args = *argsPtr;
+
+    // relative tolerance reached by all solvers
+    const NeoN::scalar relTol = 1e-6;
+
+    SECTION("OpenFOAM")
+    {
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+
+        auto ofT = randomScalarField(runTime, mesh, "T");
+        Foam::dictionary solverControls;
+        solverControls.add("solver", "PBiCGStab");
+        solverControls.add("preconditioner", "diagonal");
+        solverControls.add("tolerance", 0.0);
+        solverControls.add("relTol", relTol);
+        solverControls.add("maxIter", 1000);
+
+        BENCHMARK(std::string("OpenFOAM"))
+        {
+            // start from zero as the NeoN solves
+            ofT.primitiveFieldRef() = 0.0;
+            Foam::fvScalarMatrix TEqn(Foam::fvm::laplacian(ofT));
+            return TEqn.solve(solverControls).nIterations();
+        };
+    }
+
+    SECTION("NeoN")
+    {
+        auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+        std::unique_ptr<FoamAdapter::MeshAdapter> meshPtr = FoamAdapter::createMesh(exec, runTime);
+        FoamAdapter::MeshAdapter& mesh = *meshPtr;
+        const auto& nfMesh = mesh.nfMesh();
+
+        auto ofT = randomScalarField(runTime, mesh, "T");
+        auto nfT = FoamAdapter::constructFrom(exec, nfMesh, ofT);
+        nfT.correctBoundaryConditions();
+
+        auto nfGamma = fvcc::SurfaceField<NeoN::scalar>(
+            exec,
+            "Gamma",
+            nfMesh,
+            fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(nfMesh)
+        );
+        NeoN::fill(nfGamma.internalVector(), 1.0);
+        NeoN::fill(nfGamma.boundaryData().value(), 1.0);
+
+        const auto& sparsityPattern = la::SparsityPattern::readOrCreate(nfMesh);
+        auto ls =
+            la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(nfMesh, sparsityPattern);
+        NeoN::TokenList scheme({std::string("linear"), std::string("uncorrected")});
+        fvcc::GaussGreenLaplacian<NeoN::scalar>(exec, nfMesh, scheme)
+            .laplacian(ls, nfGamma, nfT, dsl::Coeff(1.0));
+
+        // Jacobi preconditioned BiCGStab for both paths, the Ginkgo solver in double precision
+        // and the iterative refinement with the FoamAdapter BiCGStab in single precision
+        NeoN::Dictionary solverDict = FoamAdapter::mapFvSolution(NeoN::Dictionary(
+            {{std::string("solver"), std::string("PBiCGStab")},
+             {std::string("preconditioner"), std::string("diagonal")},
+             {std::string("relTol"), relTol},
+             {std::string("maxIter"), NeoN::label(1000)}}
+        ));
+
+        SECTION("double")
+        {
+            BENCHMARK(std::string(execName))
+            {
+                NeoN::Vector<NeoN::scalar> x(exec, nfT.internalVector().size(), 0.0);
+                auto stats = NeoN::la::Solver(exec, solverDict).solve(ls, x);
+                Kokkos::fence();
+                return stats.numIter;
+            };
+        }
+
+        SECTION("mixed precision")
+        {
+            auto criteria = FoamAdapter::SolverCriteria::read(solverDict);
+            FoamAdapter::MixedPrecisionControls controls {};
+            FoamAdapter::SinglePrecisionMatrix matrix;
+
+            BENCHMARK(std::string(execName))
+            {
+                NeoN::Vector<NeoN::scalar> x(exec, nfT.internalVector().size(), 0.0);
+                matrix.update(ls, sparsityPattern);
+                auto stats = FoamAdapter::mixedPrecisionSolve(ls, x, criteria, controls, matrix);
+                Kokkos::fence();
+                return stats.numIter;
+            };
+        }
+    }
+}
+
+
+TEST_CASE("Preconditioner")
+{
+    Foam::Time& runTime = *timePtr;
+
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto preconditioner = GENERATE(
+        std::string("diagonal"),
+        std::string("blockJacobi"),
+        std::string("DIC")
+    );
+
+    std::unique_ptr<FoamAdapter::MeshAdapter> meshPtr = FoamAdapter::createMesh(exec, runTime);
+    FoamAdapter::MeshAdapter& mesh = *meshPtr;
+    const auto& nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh, "T");
+    auto nfT = FoamAdapter::constructFrom(exec, nfMesh, ofT);
+    nfT.correctBoundaryConditions();
+
+    auto nfGamma = fvcc::SurfaceField<NeoN::scalar>(
+        exec,
+        "Gamma",
+        nfMesh,
+        fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(nfMesh)
+    );
+    // a negative diffusivity yields the positive definite system required by IC
+    NeoN::fill(nfGamma.internalVector(), -1.0);
+    NeoN::fill(nfGamma.boundaryData().value(), -1.0);
+
+    auto ls = la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        nfMesh,
+        la::SparsityPattern::readOrCreate(nfMesh)
+    );
+    NeoN::TokenList scheme({std::string("linear"), std::string("uncorrected")});
+    fvcc::GaussGreenLaplacian<NeoN::scalar>(exec, nfMesh, scheme)
+        .laplacian(ls, nfGamma, nfT, dsl::Coeff(1.0));
+
+    NeoN::Dictionary solverDict = FoamAdapter::mapFvSolution(NeoN::Dictionary(
+        {{std::string("solver"), std::string("PCG")},
+         {std::string("preconditioner"), preconditioner},
+         {std::string("relTol"), NeoN::scalar(1e-6)},
+         {std::string("maxIter"), NeoN::label(1000)}}
+    ));
+
+    {
+        NeoN::Vector<NeoN::scalar> x(exec, nfT.internalVector().size(), 0.0);
+        auto stats = NeoN::la::Solver(exec, solverDict).solve(ls, x);
+        std::cout << "[bench_linearSolvers] " << preconditioner << " " << execName
+                  << " iterations: " << stats.numIter << "\n";
+    }
+
+    BENCHMARK(preconditioner + " " + execName)
+    {
+        NeoN::Vector<NeoN::scalar> x(exec, nfT.internalVector().size(), 0.0);
+        auto stats = NeoN::la::Solver(exec, solverDict).solve(ls, x);
+        Kokkos::fence();
+        return stats.numIter;
+    };
+}
@@ -0,0 +1,588 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+#include "common.hpp"
+#include "roofline.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+namespace dsl = NeoN::dsl;
+namespace nf = FoamAdapter;
+
+using Foam::Info;
+using Foam::endl;
+
+#include "fvc.H"
+#include "fvm.H"
+#include "fvMatrices.H"
+#include "pisoControl.H"
+#include "adjustPhi.H"
+#include "constrainHbyA.H"
+#include "constrainPressure.H"
+#include "findRefCell.H"
+
+// Full time steps of the example solvers against their OpenFOAM counterparts. Every solver
+// is benchmarked for a complete step, named by the executor, and for its phases, named
+// executor/phase, so gatherResults.py can normalize each phase by the OpenFOAM phase.
+// Fields are reset where a repeated benchmark run would otherwise start from a converged state.
+
+
+TEST_CASE("icoFoam")
+{
+    Foam::Time& runTime = *timePtr;
+
+    SECTION("OpenFOAM")
+    {
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+        Foam::pisoControl piso(mesh);
+
+        auto p = readField<Foam::volScalarField>(runTime, mesh, "p");
+        auto U = readField<Foam::volVectorField>(runTime, mesh, "U");
+        Foam::surfaceScalarField phi("phi", Foam::fvc::flux(U));
+        Foam::dimensionedScalar nu("nu", Foam::dimViscosity, 0.01);
+        mesh.setFluxRequired(p.name());
+
+        Foam::label pRefCell = 0;
+        Foam::scalar pRefValue = 0.0;
+        Foam::setRefCell(p, piso.dict(), pRefCell, pRefValue);
+
+        const Foam::volScalarField p0("p0", p);
+        const Foam::volVectorField U0("U0", U);
+
+        BENCHMARK(std::string("OpenFOAM"))
+        {
+            Foam::fvVectorMatrix UEqn(
+                Foam::fvm::ddt(U) + Foam::fvm::div(phi, U) - Foam::fvm::laplacian(nu, U)
+            );
+            if (piso.momentumPredictor())
+            {
+                Foam::solve(UEqn == -Foam::fvc::grad(p));
+            }
+
+            while (piso.correct())
+            {
+                Foam::volScalarField rAU(1.0 / UEqn.A());
+                Foam::volVectorField HbyA(Foam::constrainHbyA(rAU * UEqn.H(), U, p));
+                Foam::surfaceScalarField phiHbyA(
+                    "phiHbyA",
+                    Foam::fvc::flux(HbyA) + Foam::fvc::interpolate(rAU) * Foam::fvc::ddtCorr(U, phi)
+                );
+                Foam::adjustPhi(phiHbyA, U, p);
+                Foam::constrainPressure(p, U, phiHbyA, rAU);
+
+                while (piso.correctNonOrthogonal())
+                {
+                    Foam::fvScalarMatrix pEqn(
+                        Foam::fvm::laplacian(rAU, p) == Foam::fvc::div(phiHbyA)
+                    );
+                    pEqn.setReference(pRefCell, pRefValue);
+                    pEqn.solve(p.select(piso.finalInnerIter()));
+
+                    if (piso.finalNonOrthogonalIter())
+                    {
+                        phi = phiHbyA - pEqn.flux();
+                    }
+                }
+
+                U = HbyA - rAU * Foam::fvc::grad(p);
+                U.correctBoundaryConditions();
+            }
+            return p[0];
+        };
+
+        Foam::fvVectorMatrix UEqn(
+            Foam::fvm::ddt(U) + Foam::fvm::div(phi, U) - Foam::fvm::laplacian(nu, U)
+        );
+        Foam::volScalarField rAU(1.0 / UEqn.A());
+        Foam::volVectorField HbyA(Foam::constrainHbyA(rAU * UEqn.H(), U, p));
+        Foam::surfaceScalarField phiHbyA("phiHbyA", Foam::fvc::flux(HbyA));
+        Foam::fvScalarMatrix pEqn(Foam::fvm::laplacian(rAU, p) == Foam::fvc::div(phiHbyA));
+        pEqn.setReference(pRefCell, pRefValue);
+
+        BENCHMARK(std::string("OpenFOAM/assemble"))
+        {
+            Foam::fvVectorMatrix UEqn(
+                Foam::fvm::ddt(U) + Foam::fvm::div(phi, U) - Foam::fvm::laplacian(nu, U)
+            );
+            Foam::fvScalarMatrix pEqn(Foam::fvm::laplacian(rAU, p) == Foam::fvc::div(phiHbyA));
+            return UEqn.diag()[0] + pEqn.diag()[0];
+        };
+
+        BENCHMARK(std::string("OpenFOAM/solve"))
+        {
+            p.primitiveFieldRef() = p0.primitiveField();
+            return pEqn.solve(mesh.solverDict("pFinal")).nIterations();
+        };
+
+        BENCHMARK(std::string("OpenFOAM/PISO kernels"))
+        {
+            Foam::volScalarField rAU(1.0 / UEqn.A());
+            Foam::volVectorField HbyA(Foam::constrainHbyA(rAU * UEqn.H(), U0, p));
+            Foam::surfaceScalarField phiHbyA("phiHbyA", Foam::fvc::flux(HbyA));
+            phi = phiHbyA - pEqn.flux();
+            U = HbyA - rAU * Foam::fvc::grad(p);
+            U.correctBoundaryConditions();
+            return phi[0];
+        };
+
+        Foam::volScalarField pOut("ofp", p);
+        Foam::volVectorField UOut("ofU", U);
+        BENCHMARK(std::string("OpenFOAM/write"))
+        {
+            return pOut.write() && UOut.write();
+        };
+    }
+
+    SECTION("NeoN")
+    {
+        auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+        auto rt = nf::createAdapterRunTime(runTime, exec);
+        auto& mesh = rt.mesh;
+        Foam::pisoControl piso(mesh);
+
+        auto& solverDict = rt.fvSolutionDict.get<NeoN::Dictionary>("solvers");
+        solverDict.get<NeoN::Dictionary>("p") =
+            nf::mapFvSolution(solverDict.get<NeoN::Dictionary>("p"));
+        solverDict.get<NeoN::Dictionary>("U") =
+            nf::mapFvSolution(solverDict.get<NeoN::Dictionary>("U"));
+
+        auto ofp = readField<Foam::volScalarField>(runTime, mesh, "p");
+        auto ofU = readField<Foam::volVectorField>(runTime, mesh, "U");
+        Foam::surfaceScalarField ofphi("phi", Foam::fvc::flux(ofU));
+
+        Foam::label pRefCell = 0;
+        Foam::scalar pRefValue = 0.0;
+        Foam::setRefCell(ofp, piso.dict(), pRefCell, pRefValue);
+
+        auto& vectorCollection = fvcc::VectorCollection::instance(rt.db, "VectorCollection");
+        fvcc::VolumeField<NeoN::scalar>& p =
+            vectorCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                nf::CreateFromFoamField<Foam::volScalarField> {
+                    .exec = rt.exec,
+                    .nfMesh = rt.nfMesh,
+                    .foamField = ofp,
+                    .name = "p"
+                }
+            );
+        fvcc::VolumeField<NeoN::Vec3>& U =
+            vectorCollection.registerVector<fvcc::VolumeField<NeoN::Vec3>>(
+                nf::CreateFromFoamField<Foam::volVectorField> {
+                    .exec = rt.exec,
+                    .nfMesh = rt.nfMesh,
+                    .foamField = ofU,
+                    .name = "U"
+                }
+            );
+        auto& oldU = fvcc::oldTime(U);
+        oldU.internalVector() = U.internalVector();
+
+        auto nuBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(rt.nfMesh);
+        fvcc::SurfaceField<NeoN::scalar> nu(rt.exec, "nu", rt.nfMesh, nuBCs);
+        NeoN::fill(nu.internalVector(), 0.01);
+        NeoN::fill(nu.boundaryData().value(), 0.01);
+        auto phi = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofphi);
+
+        const NeoN::Vector<NeoN::scalar> p0(p.internalVector());
+        auto interpolateRAU = [&](const fvcc::VolumeField<NeoN::scalar>& crAU)
+        {
+            fvcc::SurfaceField<NeoN::scalar> rAU = fvcc::SurfaceInterpolation<NeoN::scalar>(
+                                                       rt.exec,
+                                                       rt.nfMesh,
+                                                       NeoN::TokenList({std::string("linear")})
+            )
+                                                       .interpolate(crAU);
+            rAU.name = "rAUf";
+            return rAU;
+        };
+
+        // the time step of neoIcoFoam, shared with the application
+        const bool soaVectors = runTime.controlDict().getOrDefault("soaVectors", false);
+#include "examples/neoIcoFoam/correctPressure.H"
+
+        BENCHMARK(std::string(execName))
+        {
+#include "examples/neoIcoFoam/pisoStep.H"
+            Kokkos::fence();
+            return;
+        };
+
+        nf::PDESolver<NeoN::Vec3> UEqn(
+            dsl::imp::ddt(U) + dsl::imp::div(phi, U) - dsl::imp::laplacian(nu, U),
+            U,
+            rt
+        );
+        UEqn.assemble();
+        auto [crAU, hByA] = nf::computeRAUandHByA(UEqn);
+        auto rAU = interpolateRAU(*crAU);
+        auto phiHbyA = nf::flux(*hByA, mesh);
+        nf::PDESolver<NeoN::scalar> pEqn(
+            dsl::imp::laplacian(rAU, p) - dsl::exp::div(phiHbyA),
+            p,
+            rt
+        );
+        pEqn.setReference(pRefCell, pRefValue);
+        pEqn.assemble();
+
+        BENCHMARK(std::string(execName + "/assemble"))
+        {
+            UEqn.assemble();
+            pEqn.assemble();
+            Kokkos::fence();
+            return;
+        };
+
+        // the reference and the sign change for incomplete Cholesky are applied like by solve
+        auto pLs = pEqn.constrainedSystem();
+        const auto pSolverDict = nf::removeAdapterControls(solverDict.get<NeoN::Dictionary>("p"));
+        p.internalVector() = p0;
+        requireConverged(
+            NeoN::la::Solver(exec, pSolverDict).solve(pLs, p.internalVector()),
+            pSolverDict
+        );
+
+        BENCHMARK(std::string(execName + "/solve"))
+        {
+            p.internalVector() = p0;
+            auto stats = NeoN::la::Solver(exec, pSolverDict).solve(pLs, p.internalVector());
+            Kokkos::fence();
+            return stats.numIter;
+        };
+
+        BENCHMARK(std::string(execName + "/PISO kernels"))
+        {
+            auto [crAU, hByA] = nf::computeRAUandHByA(UEqn);
+            nf::constrainHbyA(U, p, *hByA);
+            auto phiHbyA = nf::flux(*hByA, mesh);
+            nf::updateFaceVelocity(phiHbyA, pEqn, phi);
+            nf::updateVelocity(*hByA, *crAU, p, U);
+            U.correctBoundaryConditions();
+            Kokkos::fence();
+            return;
+        };
+
+        recordModel(
+            "icoFoam",
+            execName + "/computeRAUandHByA",
+            execName,
+            exec,
+            roofline::computeRAUandHByA(rt.nfMesh)
+        );
+        BENCHMARK(std::string(execName + "/computeRAUandHByA"))
+        {
+            auto [crAU, hByA] = nf::computeRAUandHByA(UEqn);
+            Kokkos::fence();
+            return;
+        };
+
+        recordModel("icoFoam", execName + "/flux", execName, exec, roofline::flux(rt.nfMesh));
+        BENCHMARK(std::string(execName + "/flux"))
+        {
+            auto phiHbyA = nf::flux(*hByA, mesh);
+            Kokkos::fence();
+            return;
+        };
+
+        BENCHMARK(std::string(execName + "/write"))
+        {
+            nf::write(p.internalVector(), mesh, "nfp");
+            nf::write(U.internalVector(), mesh, "nfU");
+            return;
+        };
+    }
+}
+
+
+TEST_CASE("laplacianFoam")
+{
+    Foam::Time& runTime = *timePtr;
+
+    SECTION("OpenFOAM")
+    {
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+
+        auto T = readField<Foam::volScalarField>(runTime, mesh, "T");
+        Foam::surfaceScalarField kappa(
+            Foam::IOobject(
+                "kappa",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("kappa", Foam::dimViscosity, 1e-3)
+        );
+        const Foam::volScalarField T0("T0", T);
+
+        BENCHMARK(std::string("OpenFOAM"))
+        {
+            T.primitiveFieldRef() = T0.primitiveField();
+            Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) - Foam::fvm::laplacian(kappa, T));
+            return TEqn.solve().nIterations();
+        };
+
+        Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) - Foam::fvm::laplacian(kappa, T));
+
+        BENCHMARK(std::string("OpenFOAM/assemble"))
+        {
+            Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) - Foam::fvm::laplacian(kappa, T));
+            return TEqn.diag()[0];
+        };
+
+        BENCHMARK(std::string("OpenFOAM/solve"))
+        {
+            T.primitiveFieldRef() = T0.primitiveField();
+            return TEqn.solve().nIterations();
+        };
+
+        Foam::volScalarField TOut("ofT", T);
+        BENCHMARK(std::string("OpenFOAM/write"))
+        {
+            return TOut.write();
+        };
+    }
+
+    SECTION("NeoN")
+    {
+        auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+        auto rt = nf::createAdapterRunTime(runTime, exec);
+        auto& mesh = rt.mesh;
+
+        auto ofT = readField<Foam::volScalarField>(runTime, mesh, "T");
+        Foam::surfaceScalarField ofKappa(
+            Foam::IOobject(
+                "kappa",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("kappa", Foam::dimViscosity, 1e-3)
+        );
+
+        auto& vectorCollection = fvcc::VectorCollection::instance(rt.db, "VectorCollection");
+        fvcc::VolumeField<NeoN::scalar>& nfT =
+            vectorCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                nf::CreateFromFoamField<Foam::volScalarField> {
+                    .exec = rt.exec,
+                    .nfMesh = rt.nfMesh,
+                    .foamField = ofT,
+                    .name = "nfT"
+                }
+            );
+        auto& nfTOld = fvcc::oldTime(nfT);
+        nfTOld.internalVector() = nfT.internalVector();
+        auto kappa = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofKappa);
+        const NeoN::Vector<NeoN::scalar> T0(nfT.internalVector());
+
+        BENCHMARK(std::string(execName))
+        {
+            nfT.internalVector() = T0;
+            nf::PDESolver<NeoN::scalar> TEqn(
+                dsl::imp::ddt(nfT) - dsl::imp::laplacian(kappa, nfT),
+                nfT,
+                rt
+            );
+            auto stats = TEqn.solve();
+            Kokkos::fence();
+            return stats.numIter;
+        };
+
+        nf::PDESolver<NeoN::scalar> TEqn(
+            dsl::imp::ddt(nfT) - dsl::imp::laplacian(kappa, nfT),
+            nfT,
+            rt
+        );
+        TEqn.assemble();
+
+        BENCHMARK(std::string(execName + "/assemble"))
+        {
+            TEqn.assemble();
+            Kokkos::fence();
+            return;
+        };
+
+        auto TLs = TEqn.constrainedSystem();
+        const auto TSolverDict = nf::removeAdapterControls(
+            rt.fvSolutionDict.get<NeoN::Dictionary>("solvers").get<NeoN::Dictionary>("nfT")
+        );
+        nfT.internalVector() = T0;
+        requireConverged(
+            NeoN::la::Solver(exec, TSolverDict).solve(TLs, nfT.internalVector()),
+            TSolverDict
+        );
+
+        BENCHMARK(std::string(execName + "/solve"))
+        {
+            nfT.internalVector() = T0;
+            auto stats = NeoN::la::Solver(exec, TSolverDict).solve(TLs, nfT.internalVector());
+            Kokkos::fence();
+            return stats.numIter;
+        };
+
+        BENCHMARK(std::string(execName + "/write"))
+        {
+            nf::write(nfT.internalVector(), mesh, "nfT");
+            return;
+        };
+    }
+}
+
+
+TEST_CASE("scalarTransportFoam")
+{
+    Foam::Time& runTime = *timePtr;
+
+    // a solenoidal vortex as in the scalarAdvection example
+    auto vortexFlux = [](const Foam::fvMesh& mesh)
+    {
+        Foam::volVectorField U(
+            Foam::IOobject(
+                "Uvortex",
+                mesh.time().timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedVector("Uvortex", Foam::dimVelocity, Foam::Zero)
+        );
+        const Foam::scalar pi = Foam::constant::mathematical::pi;
+        forAll(U, celli)
+        {
+            const Foam::scalar x = mesh.C()[celli].x();
+            const Foam::scalar y = mesh.C()[celli].y();
+            U[celli].x() = -Foam::sin(2.0 * pi * y) * Foam::pow(Foam::sin(pi * x), 2.0);
+            U[celli].y() = Foam::sin(2.0 * pi * x) * Foam::pow(Foam::sin(pi * y), 2.0);
+        }
+        return Foam::surfaceScalarField("phi", Foam::fvc::flux(U));
+    };
+
+    // the advection matrix is asymmetric, hence the T solver of the benchmark case is not used
+    Foam::dictionary solverControls;
+    solverControls.add("solver", "PBiCGStab");
+    solverControls.add("preconditioner", "DILU");
+    solverControls.add("tolerance", 1e-6);
+    solverControls.add("relTol", 0.0);
+    solverControls.add("maxIter", 1000);
+
+    SECTION("OpenFOAM")
+    {
+        std::unique_ptr<Foam::fvMesh> meshPtr = FoamAdapter::createMesh(runTime);
+        Foam::fvMesh& mesh = *meshPtr;
+
+        auto T = readField<Foam::volScalarField>(runTime, mesh, "T");
+        auto phi = vortexFlux(mesh);
+        const Foam::volScalarField T0("T0", T);
+
+        BENCHMARK(std::string("OpenFOAM"))
+        {
+            T.primitiveFieldRef() = T0.primitiveField();
+            Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) + Foam::fvm::div(phi, T));
+            return TEqn.solve(solverControls).nIterations();
+        };
+
+        Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) + Foam::fvm::div(phi, T));
+
+        BENCHMARK(std::string("OpenFOAM/assemble"))
+        {
+            Foam::fvScalarMatrix TEqn(Foam::fvm::ddt(T) + Foam::fvm::div(phi, T));
+            return TEqn.diag()[0];
+        };
+
+        BENCHMARK(std::string("OpenFOAM/solve"))
+        {
+            T.primitiveFieldRef() = T0.primitiveField();
+            return TEqn.solve(solverControls).nIterations();
+        };
+
+        Foam::volScalarField TOut("ofT", T);
+        BENCHMARK(std::string("OpenFOAM/write"))
+        {
+            return TOut.write();
+        };
+    }
+
+    SECTION("NeoN")
+    {
+        auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+        auto rt = nf::createAdapterRunTime(runTime, exec);
+        auto& mesh = rt.mesh;
+
+        auto ofT = readField<Foam::volScalarField>(runTime, mesh, "T");
+        auto ofPhi = vortexFlux(mesh);
+
+        auto& vectorCollection = fvcc::VectorCollection::instance(rt.db, "VectorCollection");
+        fvcc::VolumeField<NeoN::scalar>& nfT =
+            vectorCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                nf::CreateFromFoamField<Foam::volScalarField> {
+                    .exec = rt.exec,
+                    .nfMesh = rt.nfMesh,
+                    .foamField = ofT,
+                    .name = "nfT"
+                }
+            );
+        auto& nfTOld = fvcc::oldTime(nfT);
+        nfTOld.internalVector() = nfT.internalVector();
+        auto phi = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofPhi);
+        const NeoN::Vector<NeoN::scalar> T0(nfT.internalVector());
+
+        BENCHMARK(std::string(execName))
+        {
+            nfT.internalVector() = T0;
+            nf::PDESolver<NeoN::scalar> TEqn(
+                dsl::imp::ddt(nfT) + dsl::imp::div(phi, nfT),
+                nfT,
+                rt
+            );
+            auto stats = TEqn.solve();
+            Kokkos::fence();
+            return stats.numIter;
+        };
+
+        nf::PDESolver<NeoN::scalar> TEqn(dsl::imp::ddt(nfT) + dsl::imp::div(phi, nfT), nfT, rt);
+        TEqn.assemble();
+
+        BENCHMARK(std::string(execName + "/assemble"))
+        {
+            TEqn.assemble();
+            Kokkos::fence();
+            return;
+        };
+
+        auto TLs = TEqn.constrainedSystem();
+        const auto TSolverDict = nf::removeAdapterControls(
+            rt.fvSolutionDict.get<NeoN::Dictionary>("solvers").get<NeoN::Dictionary>("nfT")
+        );
+        nfT.internalVector() = T0;
+        requireConverged(
+            NeoN::la::Solver(exec, TSolverDict).solve(TLs, nfT.internalVector()),
+            TSolverDict
+        );
+
+        BENCHMARK(std::string(execName + "/solve"))
+        {
+            nfT.internalVector() = T0;
+            auto stats = NeoN::la::Solver(exec, TSolverDict).solve(TLs, nfT.internalVector());
+            Kokkos::fence();
+            return stats.numIter;
+        };
+
+        BENCHMARK(std::string(execName + "/write"))
+        {
+            nf::write(nfT.internalVector(), mesh, "nfT");
+            return;
+        };
+    }
+}
@@ -5,7 +5,7 @@ current_dir=$(pwd)
 
 # remove Cases directories
 # Define benchmarks to run
-benchmarks=("dsl" "explicitOperators" "implicitOperators")
+benchmarks=("dsl" "explicitOperators" "implicitOperators" "linearSolvers" "solvers" "conversion")
 
 # Run each benchmark
 for benchmark in "${benchmarks[@]}"; do
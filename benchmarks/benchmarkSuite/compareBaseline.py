@@ -0,0 +1,123 @@
+# %%
+# store catch2 benchmark results as baseline and compare later runs against it
+#
+# usage:
+#   python3 compareBaseline.py store <results> [--baselines DIR]
+#   python3 compareBaseline.py compare <results> [--baselines DIR] [--threshold 0.05] [--z 2]
+#
+# <results> is either a benchmark folder created by createStudies.py, ie. containing
+# Cases/<MeshType>_N<res>/result.xml, or a single catch2 xml file as written by the ctest
+# bench_* entries. The baseline of a benchmark is stored in <baselines>/<benchmark>.json with
+# the mean and standard deviation per test case, section, benchmark name (the executor) and mesh.
+#
+# A benchmark regresses if its mean exceeds the baseline mean by more than the relative
+# threshold and the difference is significant, ie. larger than z standard deviations of the
+# difference. compare exits with 1 if any benchmark regressed.
+
+import argparse
+import json
+import math
+import sys
+import xml.etree.ElementTree as ET
+
+from pathlib import Path
+
+
+def read_catch2_xml(file):
+    """returns {key: {"mean": ns, "std": ns, "samples": n}} of all benchmarks in the file"""
+    results = {}
+
+    def visit(node, path):
+        for child in node:
+            if child.tag == "Section":
+                visit(child, path + [child.get("name")])
+            elif child.tag == "BenchmarkResults":
+                key = "/".join(path + [child.get("name")])
+                results[key] = {
+                    "mean": float(child.find("mean").get("value")),
+                    "std": float(child.find("standardDeviation").get("value")),
+                    "samples": int(child.get("samples")),
+                }
+
+    for test_case in ET.parse(file).getroot().iter("TestCase"):
+        visit(test_case, [test_case.get("name")])
+    return results
+
+
+def read_results(source: Path):
+    """returns {mesh: results} of a benchmark folder or a single xml file"""
+    if source.is_file():
+        return {"default": read_catch2_xml(source)}
+    results = {}
+    for xml in sorted((source / "Cases").glob("*/result.xml")):
+        results[xml.parent.name] = read_catch2_xml(xml)
+    if not results:
+        sys.exit(f"could not find any result.xml in {source / 'Cases'}")
+    return results
+
+
+def baseline_file(source: Path, baselines: Path):
+    name = source.stem if source.is_file() else source.name
+    return baselines / f"{name}.json"
+
+
+def store(source: Path, baselines: Path):
+    baselines.mkdir(parents=True, exist_ok=True)
+    file = baseline_file(source, baselines)
+    results = read_results(source)
+    with open(file, "w") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    n = sum(len(r) for r in results.values())
+    print(f"stored {n} benchmarks of {len(results)} meshes in {file}")
+
+
+def compare(source: Path, baselines: Path, threshold: float, z: float):
+    file = baseline_file(source, baselines)
+    if not file.exists():
+        print(f"no baseline {file}, nothing to compare")
+        return 0
+    with open(file) as f:
+        baseline = json.load(f)
+
+    regressions = 0
+    for mesh, results in read_results(source).items():
+        for key, new in sorted(results.items()):
+            old = baseline.get(mesh, {}).get(key)
+            if old is None:
+                continue
+            diff = new["mean"] - old["mean"]
+            sigma = math.sqrt(old["std"] ** 2 + new["std"] ** 2)
+            relative = diff / old["mean"] if old["mean"] > 0 else 0.0
+            if relative > threshold and diff > z * sigma:
+                regressions += 1
+                status = "REGRESSION"
+            elif relative < -threshold and -diff > z * sigma:
+                status = "improved"
+            else:
+                status = "ok"
+            print(
+                f"{status:>10} {mesh:>14} {key}: {old['mean']:.4g} -> {new['mean']:.4g} ns"
+                f" ({100 * relative:+.1f}%)"
+            )
+
+    print(f"{regressions} significant regressions beyond {100 * threshold:.1f}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("mode", choices=["store", "compare"])
+    parser.add_argument("results", type=Path)
+    parser.add_argument(
+        "--baselines", type=Path, default=Path(__file__).parent / "baselines"
+    )
+    parser.add_argument("--threshold", type=float, default=0.05)
+    parser.add_argument("--z", type=float, default=2.0)
+    args = parser.parse_args()
+
+    if args.mode == "store":
+        store(args.results, args.baselines)
+    else:
+        sys.exit(compare(args.results, args.baselines, args.threshold, args.z))
+
+# %%
@@ -27,5 +27,5 @@ def create_cases(root, case):
     final_study.create_study(study_base_folder=case_path)
 
 root = Path(__file__).parent
-for c in ["explicitOperators",  "implicitOperators", "dsl"]:
+for c in ["explicitOperators",  "implicitOperators", "dsl", "linearSolvers", "solvers", "conversion"]:
     create_cases(root, c)
@@ -2,13 +2,15 @@
 import os
 import sys
 
+import pandas as pd
+
 from pathlib import Path
 from foamlib.postprocessing.load_tables import datafile, load_tables
 from foamlib.postprocessing.table_reader import read_catch2_benchmark
 
 # Function to normalize avg_runtime within each group relative to OpenFOAM
 def normalize_group(group):
-    baseline = group.loc[group["benchmark_name"] == "OpenFOAM", "avg_runtime"]
+    baseline = group.loc[group["executor"] == "OpenFOAM", "avg_runtime"]
     if not baseline.empty:
         group["normalized_speedup"] = baseline.values[0] / group["avg_runtime"]
     else:
@@ -16,11 +18,75 @@ def normalize_group(group):
     return group
 
 
+# add the bandwidth and FLOP rate of benchmarks recording their bytes and FLOPs in bytes.csv of
+# the case, the catch2 run time is given in ns, hence bytes per ns equals GB/s
+def add_bandwidth(df, cases):
+    try:
+        bytes_moved = load_tables(
+            source=datafile(file_name="bytes.csv", folder="."),
+            dir_name=cases,
+            reader_fn=pd.read_csv,
+        )
+    except Exception:
+        return df
+    if bytes_moved is None or bytes_moved.empty:
+        return df
+    keys = group_keys + ["test_case", "benchmark_name"]
+    bytes_moved = bytes_moved.drop_duplicates(subset=keys)
+    columns = [c for c in ["bytes", "flops", "stream_GBs"] if c in bytes_moved]
+    df = df.merge(bytes_moved[keys + columns], on=keys, how="left")
+    df["bandwidth_GBs"] = df["bytes"] / df["avg_runtime"]
+    if "flops" in df:
+        df["GFLOPs"] = df["flops"] / df["avg_runtime"]
+    if "stream_GBs" in df:
+        # share of the STREAM triad bandwidth measured on the same executor
+        df["stream_fraction"] = df["bandwidth_GBs"] / df["stream_GBs"]
+    return df
+
+
+# load the results of a thread scaling study, ie. result_t<threads>.xml of each case, and add
+# the parallel efficiency relative to the smallest thread count, returns None without a study
+def load_scaling(cases):
+    files = {f.name for f in cases.glob("*/result_t*.xml")}
+    if not files:
+        return None
+    tables = []
+    for file_name in files:
+        table = load_tables(
+            source=datafile(file_name=file_name, folder="."),
+            dir_name=cases,
+            reader_fn=read_catch2_benchmark,
+        )
+        table["threads"] = int(file_name[len("result_t") : -len(".xml")])
+        tables.append(table)
+    df = pd.concat(tables, ignore_index=True)
+
+    keys = group_keys + ["test_case", "benchmark_name"]
+    reference = df.loc[df.groupby(keys)["threads"].idxmin(), keys + ["threads", "avg_runtime"]]
+    reference = reference.rename(
+        columns={"threads": "reference_threads", "avg_runtime": "reference_runtime"}
+    )
+    df = df.merge(reference, on=keys, how="left")
+    df["parallel_efficiency"] = (df["reference_threads"] * df["reference_runtime"]) / (
+        df["threads"] * df["avg_runtime"]
+    )
+    return df.drop(columns=["reference_threads", "reference_runtime"])
+
+
+# split benchmark names of the form executor/phase, names without a phase time a full step
+def split_phase(df):
+    names = df["benchmark_name"].str.split("/", n=1, expand=True)
+    df["executor"] = names[0]
+    df["phase"] = names[1].fillna("step") if names.shape[1] > 1 else "step"
+    return df
+
+
 # save per test case
 def save_test_results(df, test_case: str):
     test_case_df = df[df["test_case"] == test_case]
     if not test_case_df.empty:
-        test_case_df = test_case_df.groupby(group_keys).apply(
+        test_case_df = split_phase(test_case_df.copy())
+        test_case_df = test_case_df.groupby(group_keys + ["phase"]).apply(
             normalize_group, include_groups=False
         ).reset_index()
         test_case_df.to_csv(results / f"{test_case}.csv", index=False)
@@ -36,10 +102,16 @@ if __name__ == "__main__":
 
     group_keys = ["MeshType", "Resolution"]
 
-    file = datafile(file_name="result.xml", folder=".")
-    benchmark_results = load_tables(
-        source=file, dir_name=cases, reader_fn=read_catch2_benchmark
-    )
+    benchmark_results = load_scaling(cases)
+    if benchmark_results is None:
+        file = datafile(file_name="result.xml", folder=".")
+        benchmark_results = load_tables(
+            source=file, dir_name=cases, reader_fn=read_catch2_benchmark
+        )
+    benchmark_results = add_bandwidth(benchmark_results, cases)
+    if "threads" in benchmark_results:
+        # normalize against OpenFOAM at the same thread count
+        group_keys.append("threads")
     try:
         for test_case in benchmark_results["test_case"].unique():
             save_test_results(benchmark_results, test_case)
@@ -3,11 +3,14 @@ cd "${0%/*}" || exit
 
 current_dir=$(pwd)
 
+# arguments are passed to the benchmarks, ie. ./runAll.sh --scaling runs a thread scaling study
+benchmark_args="$@"
+
 # run benchmarks
 run_benchmark() {
     echo "Running $2 benchmarks in: $1"
     # mkdir -p $1/results
-    find $1 -name "Allrun" -exec {} bench_$2 \;
+    find $1 -name "Allrun" -exec {} bench_$2 $benchmark_args \;
 
     echo "Gathering results..." $1
     python3 gatherResults.py $1
@@ -20,7 +23,7 @@ echo "Creating study..."
 python3 createStudies.py
 
 # Define benchmarks to run
-benchmarks=("explicitOperators" "implicitOperators" "dsl")
+benchmarks=("explicitOperators" "implicitOperators" "dsl" "linearSolvers" "solvers" "conversion")
 # Run each benchmark
 for benchmark in "${benchmarks[@]}"; do
     run_benchmark "$current_dir/$benchmark" $benchmark
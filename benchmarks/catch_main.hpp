@@ -2,6 +2,14 @@
 // SPDX-FileCopyrightText: 2023 FoamAdapter authors
 
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "Kokkos_Core.hpp"
 
 #include <catch2/benchmark/catch_benchmark.hpp>
@@ -23,8 +31,90 @@ Foam::Time* timePtr;    // A single time object
 Foam::argList* argsPtr; // Some forks want argList access at createMesh.H
 
 
+/* quotes an argument for the shell */
+std::string shellQuote(const std::string& arg)
+{
+    std::string quoted = "'";
+    for (char c : arg)
+    {
+        if (c == '\'') quoted += "'\\''";
+        else quoted += c;
+    }
+    return quoted + "'";
+}
+
+/* inserts the thread count before the extension of a file name, ie. result_t4.xml */
+std::string threadFileName(const std::string& fileName, int nThreads)
+{
+    const auto dot = fileName.rfind('.');
+    const std::string suffix = "_t" + std::to_string(nThreads);
+    if (dot == std::string::npos) return fileName + suffix;
+    return fileName.substr(0, dot) + suffix + fileName.substr(dot);
+}
+
+/* @brief runs the benchmark once per Kokkos thread count if --scaling is given
+ *
+ * @details Kokkos fixes the number of threads at initialization, hence the benchmark executable
+ * is executed again for 1, 2, 4, ... threads up to --scaling-max-threads, defaulting to the
+ * number of hardware threads. The affinity of the threads is set by --scaling-affinity
+ * close|spread|none through OMP_PROC_BIND and OMP_PLACES. The output file given by -o or --out
+ * gets the thread count appended, ie. result.xml becomes result_t1.xml, result_t2.xml, ...
+ * @return the exit code of the study or -1 if --scaling is not given
+ */
+int runScalingStudy(int argc, char* argv[])
+{
+    bool scaling = false;
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    std::string affinity = "close";
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--scaling") == 0) scaling = true;
+        else if (strcmp(argv[i], "--scaling-max-threads") == 0 && i + 1 < argc)
+            maxThreads = std::stoi(argv[++i]);
+        else if (strcmp(argv[i], "--scaling-affinity") == 0 && i + 1 < argc)
+            affinity = argv[++i];
+        else args.push_back(argv[i]);
+    }
+    if (!scaling) return -1;
+
+    if (affinity != "none")
+    {
+        setenv("OMP_PROC_BIND", affinity.c_str(), 1);
+        setenv("OMP_PLACES", "cores", 1);
+    }
+
+    std::vector<int> threadCounts;
+    for (int n = 1; n < maxThreads; n *= 2)
+    {
+        threadCounts.push_back(n);
+    }
+    threadCounts.push_back(std::max(maxThreads, 1));
+
+    int result = 0;
+    for (int nThreads : threadCounts)
+    {
+        std::string command =
+            shellQuote(argv[0]) + " --kokkos-num-threads=" + std::to_string(nThreads);
+        for (std::size_t i = 0; i < args.size(); i++)
+        {
+            command += " " + shellQuote(args[i]);
+            if ((args[i] == "-o" || args[i] == "--out") && i + 1 < args.size())
+            {
+                command += " " + shellQuote(threadFileName(args[++i], nThreads));
+            }
+        }
+        std::cout << "Running with " << nThreads << " threads: " << command << std::endl;
+        if (std::system(command.c_str()) != 0) result = 1;
+    }
+    return result;
+}
+
+
 int main(int argc, char* argv[])
 {
+    if (int result = runScalingStudy(argc, argv); result >= 0) return result;
+
     // Kokkos::initialize(argc, argv);
     Kokkos::ScopeGuard guard(argc, argv);
     Catch::Session session;
@@ -37,3 +37,48 @@ auto randomScalarField(const Foam::Time& runTime, const Foam::fvMesh& mesh, Foam
     std::uniform_real_distribution<> dis(1.0, 2.0);
     return createRandomField<Foam::volScalarField>(runTime, mesh, name, [&]() { return dis(gen); });
 }
+
+/* function to create a volVectorField filled with random values for test purposes */
+auto randomVectorField(const Foam::Time& runTime, const Foam::fvMesh& mesh, Foam::word name)
+{
+    std::random_device rd;  // Will be used to obtain a seed for the random number engine
+    std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+    std::uniform_real_distribution<> dis(1.0, 2.0);
+    return createRandomField<Foam::volVectorField>(
+        runTime,
+        mesh,
+        name,
+        [&]() { return Foam::vector {dis(gen), dis(gen), dis(gen)}; }
+    );
+}
+
+/* function to read a field of the benchmark case, ie. from its 0 directory */
+template<typename FieldType>
+FieldType readField(const Foam::Time& runTime, const Foam::fvMesh& mesh, Foam::word name)
+{
+    return FieldType(
+        Foam::IOobject(
+            name,
+            runTime.timeName(),
+            mesh,
+            Foam::IOobject::MUST_READ,
+            Foam::IOobject::NO_WRITE
+        ),
+        mesh
+    );
+}
+
+/* @brief requires the solve to meet the tolerances of the solver dictionary
+ * @details the timings of a solve that broke down or stopped at the iteration limit are
+ * meaningless
+ */
+void requireConverged(const NeoN::la::SolverStats& stats, const NeoN::Dictionary& solverDict)
+{
+    const auto criteria = FoamAdapter::SolverCriteria::read(solverDict);
+    REQUIRE(std::isfinite(stats.finalResNorm));
+    REQUIRE(stats.numIter < criteria.maxIter);
+    REQUIRE(
+        stats.finalResNorm
+        <= std::max(criteria.absTol, criteria.relTol * stats.initResNorm) * (1.0 + 1e-12)
+    );
+}
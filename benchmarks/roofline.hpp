@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+
+// Analytic byte and FLOP models of the benchmarked kernels. Each array is assumed to be moved
+// once between memory and the compute units, ie. perfect caching of the gathered cell values,
+// and read-modify-write accesses count twice. FLOPs are counted per value component. Together
+// with the run time they give the achieved GB/s and GFLOP/s, the GB/s are compared against a
+// STREAM triad measured on the same executor.
+
+/* bytes moved and floating point operations of one kernel call */
+struct KernelModel
+{
+    std::size_t bytes = 0;
+    std::size_t flops = 0;
+};
+
+template<typename ValueType>
+constexpr std::size_t nComponents = sizeof(ValueType) / sizeof(NeoN::scalar);
+
+namespace roofline
+{
+
+constexpr std::size_t scalarBytes = sizeof(NeoN::scalar);
+constexpr std::size_t idxBytes = sizeof(NeoN::localIdx);
+
+/* explicit Gauss Green divergence of a face flux and linearly interpolated cell values */
+template<typename ValueType>
+KernelModel explicitDiv(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t v = sizeof(ValueType), nc = nComponents<ValueType>;
+    const std::size_t nCells = mesh.nCells(), nInternal = mesh.nInternalFaces(),
+                      nBoundary = mesh.nBoundaryFaces();
+    return {
+        // owner, neighbour, flux, weight / faceCells, flux, boundary value / value, volume, result
+        .bytes = nInternal * (2 * idxBytes + 2 * scalarBytes)
+               + nBoundary * (idxBytes + scalarBytes + v) + nCells * (v + scalarBytes + 2 * v),
+        // interpolation, flux product, owner and neighbour contributions / division by volume
+        .flops = nc * (6 * nInternal + 2 * nBoundary + nCells)
+    };
+}
+
+/* explicit Gauss Green laplacian with uncorrected surface normal gradient */
+template<typename ValueType>
+KernelModel explicitLaplacian(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t v = sizeof(ValueType), nc = nComponents<ValueType>;
+    const std::size_t nCells = mesh.nCells(), nInternal = mesh.nInternalFaces(),
+                      nBoundary = mesh.nBoundaryFaces();
+    return {
+        // owner, neighbour, gamma, magSf, deltaCoeffs / faceCells and boundary values
+        .bytes = nInternal * (2 * idxBytes + 3 * scalarBytes)
+               + nBoundary * (idxBytes + 3 * scalarBytes + v) + nCells * (v + scalarBytes + 2 * v),
+        // face coefficient, difference, product, owner and neighbour contributions
+        .flops = (4 * nc + 2) * (nInternal + nBoundary) + nc * nCells
+    };
+}
+
+/* assembly of the implicit Gauss Green divergence into the preallocated linear system */
+template<typename ValueType>
+KernelModel implicitDiv(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t v = sizeof(ValueType), nc = nComponents<ValueType>;
+    const std::size_t nCells = mesh.nCells(), nInternal = mesh.nInternalFaces(),
+                      nBoundary = mesh.nBoundaryFaces();
+    const std::size_t nNonZeros = nCells + 2 * nInternal;
+    return {
+        // owner, neighbour, their row offsets, flux, weight / faceCells, flux, boundary
+        // coefficients / reset and update of the values and the right hand side
+        .bytes = nInternal * (4 * idxBytes + 2 * scalarBytes)
+               + nBoundary * (idxBytes + scalarBytes + 2 * v) + 3 * nNonZeros * v
+               + nCells * (idxBytes + 3 * v),
+        // four coefficients per internal face, diagonal and source per boundary face
+        .flops = nc * (6 * nInternal + 4 * nBoundary)
+    };
+}
+
+/* assembly of the implicit Gauss Green laplacian into the preallocated linear system */
+template<typename ValueType>
+KernelModel implicitLaplacian(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t v = sizeof(ValueType), nc = nComponents<ValueType>;
+    const std::size_t nCells = mesh.nCells(), nInternal = mesh.nInternalFaces(),
+                      nBoundary = mesh.nBoundaryFaces();
+    const std::size_t nNonZeros = nCells + 2 * nInternal;
+    return {
+        .bytes = nInternal * (4 * idxBytes + 3 * scalarBytes)
+               + nBoundary * (idxBytes + 3 * scalarBytes + 2 * v) + 3 * nNonZeros * v
+               + nCells * (idxBytes + 3 * v),
+        .flops = nc * (4 * nInternal + 4 * nBoundary) + 2 * (nInternal + nBoundary)
+    };
+}
+
+/* reciprocal diagonal and H/A of a Vec3 system with scalar coefficients */
+KernelModel computeRAUandHByA(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t vec = sizeof(NeoN::Vec3);
+    const std::size_t nCells = mesh.nCells(), nInternal = mesh.nInternalFaces();
+    return {
+        // rAU: row offset, diagonal offset, diagonal, volume and result
+        .bytes = nCells * (2 * idxBytes + 3 * scalarBytes)
+               // face loop: owner, neighbour, their row and face offsets, upper and lower
+               // coefficients, velocities and the atomic updates of H
+               + nInternal * (6 * idxBytes + 2 * scalarBytes + 2 * vec + 4 * vec)
+               // reset of H, source, rAU, volume and scaling of H
+               + nCells * (vec + vec + 2 * scalarBytes + 2 * vec),
+        .flops = 2 * nCells + 12 * nInternal + 7 * nCells
+    };
+}
+
+/* face flux of a linearly interpolated Vec3 field */
+KernelModel flux(const NeoN::UnstructuredMesh& mesh)
+{
+    const std::size_t vec = sizeof(NeoN::Vec3);
+    const std::size_t nInternal = mesh.nInternalFaces(), nBoundary = mesh.nBoundaryFaces();
+    return {
+        // reset, owner, neighbour, weight, face area, velocities, flux / Sf, boundary value,
+        // flux and boundary flux
+        .bytes = (nInternal + nBoundary) * scalarBytes
+               + nInternal * (2 * idxBytes + 2 * scalarBytes + 3 * vec)
+               + nBoundary * (2 * vec + 2 * scalarBytes),
+        // interpolation and dot product / dot product
+        .flops = 14 * nInternal + 5 * nBoundary
+    };
+}
+
+}
+
+/* @brief STREAM triad bandwidth of the executor in GB/s, measured once per executor name
+ * @note the arrays exceed the last level caches of current CPUs
+ */
+NeoN::scalar streamBandwidth(const std::string& execName, const NeoN::Executor& exec)
+{
+    static std::map<std::string, NeoN::scalar> measured;
+    if (auto it = measured.find(execName); it != measured.end()) return it->second;
+
+    const std::size_t n = std::size_t(1) << 25;
+    NeoN::Vector<NeoN::scalar> a(exec, n, 0.0);
+    NeoN::Vector<NeoN::scalar> b(exec, n, 1.0);
+    NeoN::Vector<NeoN::scalar> c(exec, n, 2.0);
+    auto aView = a.view();
+    const auto [bView, cView] = views(b, c);
+
+    NeoN::scalar best = std::numeric_limits<NeoN::scalar>::max();
+    for (int run = 0; run < 11; run++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        NeoN::parallelFor(
+            exec,
+            {0, n},
+            KOKKOS_LAMBDA(const size_t i) { aView[i] = bView[i] + 3.0 * cView[i]; }
+        );
+        Kokkos::fence();
+        const NeoN::scalar seconds =
+            std::chrono::duration<NeoN::scalar>(std::chrono::steady_clock::now() - start).count();
+        // the first run includes the first touch of the pages
+        if (run > 0) best = std::min(best, seconds);
+    }
+    const NeoN::scalar bandwidth = 3.0 * n * sizeof(NeoN::scalar) / best / 1e9;
+    measured[execName] = bandwidth;
+    return bandwidth;
+}
+
+/* @brief appends the model of a benchmark and the STREAM bandwidth of its executor to
+ * bytes.csv of the case, gatherResults.py divides them by the run time
+ */
+void recordModel(
+    const std::string& testCase,
+    const std::string& benchmark,
+    const std::string& execName,
+    const NeoN::Executor& exec,
+    KernelModel model
+)
+{
+    const NeoN::scalar stream = streamBandwidth(execName, exec);
+    const std::string fileName = timePtr->path() + "/bytes.csv";
+    const bool newFile = !std::ifstream(fileName).good();
+    std::ofstream os(fileName, std::ios::app);
+    if (newFile)
+    {
+        os << "test_case,benchmark_name,bytes,flops,stream_GBs\n";
+    }
+    os << testCase << "," << benchmark << "," << model.bytes << "," << model.flops << ","
+       << stream << "\n";
+}
@@ -23,12 +23,14 @@ namespace nf = FoamAdapter;
 
 int main(int argc, char* argv[])
 {
-    Kokkos::initialize(argc, argv);
+    nf::initializeKokkos(argc, argv);
     {
 #include "addCheckCaseOptions.H"
+        nf::addMemoryReportOption();
 #include "setRootCase.H"
 #include "createTime.H"
 
+        nf::enableMemoryReport(args);
         auto rt = nf::createAdapterRunTime(runTime);
         auto& mesh = rt.mesh;
 
@@ -48,9 +50,10 @@ int main(int argc, char* argv[])
                     .name = "nfT"
                 }
             );
+        nf::trackMemory(nfT);
         auto& nfTOld = oldTime(nfT);
         nfTOld.internalVector() = nfT.internalVector();
-        nfT.correctBoundaryConditions();
+        nf::correctBoundaryConditions(nfT, rt.mesh);
 
         auto nfKappa = nf::constructSurfaceField(rt.exec, rt.nfMesh, kappa);
 
@@ -59,6 +62,7 @@ int main(int argc, char* argv[])
         Info << "\nStarting time loop\n" << endl;
         while (runTime.loop())
         {
+            nf::ScopedTimer timeStepTimer("timeStep");
             Info << "Time = " << runTime.timeName() << nl << endl;
 
             Foam::scalar t = runTime.time().value();
@@ -74,6 +78,7 @@ int main(int argc, char* argv[])
                 rt.fvSchemesDict,
                 rt.fvSolutionDict.get<NeoN::Dictionary>("solvers").get<NeoN::Dictionary>("nfT")
             );
+            nf::exchangeHalo(nfT, rt.mesh);
 
             runTime.write();
             if (runTime.outputTime())
@@ -83,8 +88,11 @@ int main(int argc, char* argv[])
             }
 
             runTime.printExecutionTime(Info);
+            nf::printMemoryUsage(runTime);
         }
 
+        nf::printExecutionTime(runTime);
+        nf::printMemoryReport();
         Foam::Info << "End\n" << Foam::endl;
     }
     Kokkos::finalize();
@@ -21,12 +21,14 @@ namespace nf = FoamAdapter;
 
 int main(int argc, char* argv[])
 {
-    Kokkos::initialize(argc, argv);
+    nf::initializeKokkos(argc, argv);
     {
 #include "addCheckCaseOptions.H"
+        nf::addMemoryReportOption();
 #include "setRootCase.H"
 #include "createTime.H"
 
+        nf::enableMemoryReport(args);
         auto rt = nf::createAdapterRunTime(runTime);
         auto& mesh = rt.mesh;
 
@@ -54,6 +56,7 @@ int main(int argc, char* argv[])
                     .name = "p"
                 }
             );
+        nf::trackMemory(p);
 
         Info << "creating nf velocity field" << endl;
         fvcc::VolumeField<NeoN::Vec3>& U =
@@ -65,6 +68,7 @@ int main(int argc, char* argv[])
                     .name = "U"
                 }
             );
+        nf::trackMemory(U);
 
         Info << "creating nf nu field" << endl;
         auto nuBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(rt.nfMesh);
@@ -74,111 +78,93 @@ int main(int argc, char* argv[])
 
         Info << "creating nf phi field" << endl;
         auto phi = nf::constructSurfaceField(rt.exec, rt.nfMesh, ofphi);
+
+        // restart from collated output if present
+        if (collatedRestart)
+        {
+            Info << "restoring collated p, U and phi fields" << endl;
+            if (!rt.collatedWriter->read(p, "p") || !rt.collatedWriter->read(U, "U")
+                || !rt.collatedWriter->read(phi, "phi"))
+            {
+                Foam::FatalError << "incomplete collated restart in "
+                                 << rt.collatedWriter->directory().string()
+                                 << ", expected p, U and phi" << Foam::nl
+                                 << Foam::abort(Foam::FatalError);
+            }
+        }
+
+        // couple the processor patches of decomposed runs
+        nf::exchangeHalo(p, mesh);
+        nf::exchangeHalo(U, mesh);
+
+        // HbyA and the pressure gradient of the PISO correctors in structure of arrays layout
+        const bool soaVectors = runTime.controlDict().getOrDefault("soaVectors", false);
+        if (mesh.singlePrecisionGeometry() && !soaVectors)
+        {
+            Foam::FatalError << "singlePrecisionGeometry only applies to the structure of arrays"
+                             << " kernels, set soaVectors yes; in the controlDict" << Foam::nl
+                             << Foam::abort(Foam::FatalError);
+        }
+
+#include "correctPressure.H"
+
         // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
+        // the Courant number of a step is computed on the device while the host finishes the
+        // step, it is only waited for when the next step sets deltaT
+        nf::CourantTimeStepControl coControl(mesh);
+        if (rt.adjustTimeStep)
+        {
+            coControl.start(phi, rt.dt);
+        }
+
         Info << "\nStarting time loop\n" << endl;
         while (runTime.loop())
         {
+            nf::ScopedTimer timeStepTimer("timeStep");
             Info << "Time = " << runTime.timeName() << nl << endl;
 
             auto& oldU = fvcc::oldTime(U);
             oldU.internalVector() = U.internalVector();
 
-            auto coNum = fvcc::computeCoNum(phi, rt.dt);
             if (rt.adjustTimeStep)
             {
-                nf::setDeltaT(runTime, rt, coNum);
+                coControl.setDeltaT(runTime, rt);
             }
+            rt.t = runTime.value();
 
-            // Momentum predictor
-            nf::PDESolver<NeoN::Vec3> UEqn(
-                dsl::imp::ddt(U) + dsl::imp::div(phi, U) - dsl::imp::laplacian(nu, U),
-                U,
-                rt
-            );
+#include "pisoStep.H"
 
-            if (piso.momentumPredictor())
-            {
-                UEqn.solve();
-            }
-            else
-            {
-                // NOTE since computing rAU and HbyA requires an assembled system matrix we
-                // explicitly trigger assembly here.
-                UEqn.assemble();
-            }
-
-            // --- PISO loop
-            while (piso.correct())
+            if (rt.adjustTimeStep)
             {
-                Info << "PISO loop" << endl;
-                auto [crAU, hByA] = nf::computeRAUandHByA(UEqn);
-                nf::constrainHbyA(U, p, hByA);
-
-                nnfvcc::SurfaceField<NeoN::scalar> rAU =
-                    fvcc::SurfaceInterpolation<NeoN::scalar>(
-                        rt.exec,
-                        rt.nfMesh,
-                        NeoN::TokenList({std::string("linear")})
-                    )
-                        .interpolate(crAU);
-                rAU.name = "rAUf";
-
-                auto phiHbyA = nf::flux(hByA);
-                // TODO: OpenFOAM typically also corrects phiHbyA with
-                // + fvc::interpolate(rAU) * fvc::ddtCorr(U, phi);
-                // for the first term we can use but fvc::ddtCorr is missing
-                // NeoN::Input input = NeoN::TokenList({"linear"});
-                // fvcc::SurfaceInterpolation<NeoN::scalar> surfInterpolation(rt.exec, rt.nfMesh,
-                // input); auto surfRAU = surfInterpolation.interpolate(rAU);
-
-                // TODO additionally missing
-                // Foam::adjustPhi(phiHbyA, U, p);
-                // Update the pressure BCs to ensure flux consistency
-                // Foam::constrainPressure(p, U, phiHbyA, rAU);
-
-                // Non-orthogonal pressure corrector loop
-                while (piso.correctNonOrthogonal())
-                {
-                    // Pressure corrector
-                    nf::PDESolver<NeoN::scalar> pEqn(
-                        NeoN::dsl::imp::laplacian(rAU, p) - NeoN::dsl::exp::div(phiHbyA),
-                        p,
-                        rt
-                    );
-
-                    if (ofp.needReference() && pRefCell >= 0)
-                    {
-                        pEqn.setReference(pRefCell, pRefValue);
-                    }
-
-                    auto stats = pEqn.solve();
-                    p.correctBoundaryConditions();
-
-                    if (piso.finalNonOrthogonalIter())
-                    {
-                        nf::updateFaceVelocity(phiHbyA, pEqn, phi);
-                    }
-                }
-                // TODO: missing
-                // #include "continuityErrs.H"
-
-                nf::updateVelocity(hByA, crAU, p, U);
-                U.correctBoundaryConditions();
+                coControl.start(phi, rt.dt);
             }
 
             runTime.write();
             if (runTime.outputTime())
             {
-                Info << "writing p field" << endl;
-                write(p.internalVector(), mesh, "p");
-                Info << "writing U field" << endl;
-                write(U.internalVector(), mesh, "U");
+                if (rt.collatedWriter)
+                {
+                    Info << "writing collated p, U and phi fields" << endl;
+                    rt.collatedWriter->write(p, "p");
+                    rt.collatedWriter->write(U, "U");
+                    rt.collatedWriter->write(phi, "phi");
+                }
+                else
+                {
+                    Info << "writing p field" << endl;
+                    write(p.internalVector(), mesh, "p");
+                    Info << "writing U field" << endl;
+                    write(U.internalVector(), mesh, "U");
+                }
             }
 
             runTime.printExecutionTime(Info);
+            nf::printMemoryUsage(runTime);
         }
 
+        nf::printExecutionTime(runTime);
+        nf::printMemoryReport();
         Info << "End\n" << endl;
     }
     Kokkos::finalize();
@@ -19,12 +19,14 @@ namespace nf = FoamAdapter;
 
 int main(int argc, char* argv[])
 {
-    Kokkos::initialize(argc, argv);
+    nf::initializeKokkos(argc, argv);
     {
 #include "addCheckCaseOptions.H"
+        nf::addMemoryReportOption();
 #include "setRootCase.H"
 #include "createTime.H"
 
+        nf::enableMemoryReport(args);
         auto rt = nf::createAdapterRunTime(runTime);
         auto& mesh = rt.mesh;
 
@@ -43,35 +45,46 @@ int main(int argc, char* argv[])
                     .name = "nfT"
                 }
             );
+        nf::trackMemory(nfT);
         auto nfPhi0 = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, phi0);
         auto nfPhi = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, phi);
 
         Foam::scalar endTime = rt.controlDict.get<Foam::scalar>("endTime");
+        nf::CourantTimeStepControl coControl(mesh);
 
         while (runTime.run())
         {
+            nf::ScopedTimer timeStepTimer("timeStep");
             Foam::scalar t = runTime.time().value();
             Foam::scalar dt = runTime.deltaT().value();
 
             auto& nfOldT = fvcc::oldTime(nfT);
             nfOldT.internalVector() = nfT.internalVector();
 
-            if (rt.controlDict.get<int>("setFields"))
+            const bool setFields = rt.controlDict.get<int>("setFields");
+            Foam::scalar pi = Foam::constant::mathematical::pi;
+            Foam::scalar scale = Foam::cos(pi * (t + 0.5 * dt) / endTime);
+            if (setFields)
             {
-                Foam::scalar pi = Foam::constant::mathematical::pi;
-                U = U0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
-                phi = phi0 * Foam::cos(pi * (t + 0.5 * dt) / endTime);
-
-                nfPhi.internalVector() =
-                    nfPhi0.internalVector() * std::cos(pi * (t + 0.5 * dt) / endTime);
+                nfPhi.internalVector() = nfPhi0.internalVector() * scale;
             }
 
-            auto coNum = fvcc::computeCoNum(nfPhi, dt);
+            // the Courant number of nfPhi is reduced on the device while the host updates
+            // and reports the OpenFOAM fields
+            if (rt.adjustTimeStep)
+            {
+                coControl.start(nfPhi, dt);
+            }
+            if (setFields)
+            {
+                U = U0 * scale;
+                phi = phi0 * scale;
+            }
             Foam::Info << "max(phi) : " << max(phi).value() << Foam::endl;
             Foam::Info << "max(U) : " << max(U).value() << Foam::endl;
             if (rt.adjustTimeStep)
             {
-                FoamAdapter::setDeltaT(runTime, rt, coNum);
+                coControl.setDeltaT(runTime, rt);
             }
             runTime++;
 
@@ -90,8 +103,11 @@ int main(int argc, char* argv[])
 
             runTime.write();
             runTime.printExecutionTime(Info);
+            nf::printMemoryUsage(runTime);
         }
 
+        nf::printExecutionTime(runTime);
+        nf::printMemoryReport();
         Info << "End\n" << endl;
     }
     Kokkos::finalize();
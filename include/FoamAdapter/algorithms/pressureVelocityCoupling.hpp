@@ -37,13 +37,20 @@ void constrainHbyA(
     nnfvcc::VolumeField<Vec3>& HbyA
 );
 
+/* @brief constrainHbyA of a structure of arrays HbyA */
+void constrainHbyA(
+    const nnfvcc::VolumeField<Vec3>& U,
+    const nnfvcc::VolumeField<scalar>& p,
+    SoAVolumeField& HbyA
+);
+
 /* @brief given a ... this function computes rAU
  *
  * where rAU  - inverse of the system matrix diagonal
  *
- * @return a tuple containing rAU and HbyA
+ * @return rAU, drawn from the field pool of the RunTime
  */
-nnfvcc::VolumeField<scalar> computeRAU(const PDESolver<Vec3>& expr);
+PooledVolumeField<scalar> computeRAU(const PDESolver<Vec3>& expr);
 
 /* @brief given access to a PDESolver this function computes rAU and HbyA
  * from the assembled system
@@ -51,14 +58,32 @@ nnfvcc::VolumeField<scalar> computeRAU(const PDESolver<Vec3>& expr);
  * where rAU  - inverse of the system matrix diagonal
  *       HbyA - offdiagonal entries divided by diagonal
  *
+ * On decomposed meshes the processor faces of rAU and HbyA are set to the interpolate with the
+ * neighbour rank, the exchange of rAU overlaps with the face loop.
+ * Both fields are drawn from the field pool of the RunTime and returned to it once the handles
+ * go out of scope, hence the next corrector reuses them without allocating.
+ *
  * @return a tuple containing rAU and HbyA
  */
-std::tuple<nnfvcc::VolumeField<scalar>, nnfvcc::VolumeField<Vec3>>
+std::tuple<PooledVolumeField<scalar>, PooledVolumeField<Vec3>>
 computeRAUandHByA(const PDESolver<Vec3>& expr);
 
+/* @brief computes rAU and HbyA with HbyA in structure of arrays layout
+ *
+ * @details the face loop accumulates H with one scalar atomic per component instead of an atomic
+ * on the Vec3. The boundary values of HbyA are the adjacent cell values, like the extrapolated
+ * boundaries of the array of structures version, and the interpolate with the neighbour rank on
+ * processor faces.
+ *
+ * @return rAU, drawn from the field pool of the RunTime
+ */
+PooledVolumeField<scalar> computeRAUandHByA(const PDESolver<Vec3>& expr, SoAVolumeField& HbyA);
+
 /* @brief computes phi = phiHbyA - pEqn.flux();
  * where pEqn.flux
  * @note assumes an assembled system matrix
+ * @note on decomposed meshes the exchange of the neighbour pressure overlaps with the internal
+ * and physical boundary faces
  */
 void updateFaceVelocity(
     const nnfvcc::SurfaceField<scalar>& predictedPhi,
@@ -81,10 +106,65 @@ void updateVelocity(
     nnfvcc::VolumeField<Vec3>& U
 );
 
+/* @brief updateVelocity with HbyA and the pressure gradient in structure of arrays layout
+ * @note only the internal values of U are set, like the array of structures version
+ */
+void updateVelocity(
+    const SoAVolumeField& hByA,
+    const nnfvcc::VolumeField<scalar>& rAU,
+    const nnfvcc::VolumeField<scalar>& p,
+    const MeshAdapter& mesh,
+    nnfvcc::VolumeField<Vec3>& U
+);
+
+/* @brief Gauss Green gradient with linear interpolation into a structure of arrays field
+ * @details each face adds to the owner and neighbour with three scalar atomics
+ * @note only the internal values are computed, the boundary values of grad are unchanged
+ * @note the internal face geometry is read in single precision with singlePrecisionGeometry
+ */
+void gaussGreenGrad(
+    const nnfvcc::VolumeField<scalar>& p,
+    const MeshAdapter& mesh,
+    SoAVolumeField& grad
+);
+
 
 /* @brief Reimplementation of OpenFOAMs fvMatrix.flux()
+ * @details the boundary faces, including the processor faces, use the boundary values of the
+ * field, eg. the HbyA returned by computeRAUandHByA, whose processor faces are already exchanged
+ * @note reads the face connectivity of the NeoN mesh, the MeshAdapter overload reads the
+ * connectivity of the adapter kernels
  * @return flux surface field
  */
 nnfvcc::SurfaceField<scalar> flux(const nnfvcc::VolumeField<Vec3>& volField);
 
+/* @brief flux of a field on a decomposed mesh whose processor faces are not up to date
+ * @details the neighbour values of the processor faces are exchanged while the internal and
+ * physical boundary faces are computed, the processor faces are computed last
+ */
+nnfvcc::SurfaceField<scalar>
+flux(const nnfvcc::VolumeField<Vec3>& volField, const ProcessorInterfaces& interfaces);
+
+/* @brief flux reading the face connectivity of the adapter kernels, see MeshAdapter::connectivity
+ * @details the boundary faces, including the processor faces, use the boundary values of the
+ * field
+ */
+nnfvcc::SurfaceField<scalar>
+flux(const nnfvcc::VolumeField<Vec3>& volField, const MeshAdapter& meshAdapter);
+
+/* @brief flux reading the face connectivity of the adapter kernels on a decomposed mesh whose
+ * processor faces are not up to date
+ */
+nnfvcc::SurfaceField<scalar> flux(
+    const nnfvcc::VolumeField<Vec3>& volField,
+    const MeshAdapter& meshAdapter,
+    const ProcessorInterfaces& interfaces
+);
+
+/* @brief flux of a structure of arrays field
+ * @details the boundary faces, including the processor faces, use the boundary values of the field
+ * @note the internal face geometry is read in single precision with singlePrecisionGeometry
+ */
+nnfvcc::SurfaceField<scalar> flux(const SoAVolumeField& volField, const MeshAdapter& mesh);
+
 }
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "NeoN/NeoN.hpp"
+
+#include "Time.H"
+
+#include "FoamAdapter/auxiliary/timing.hpp"
+#include "FoamAdapter/auxiliary/writers.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace FoamAdapter
+{
+
+/* @brief the location and size of the data of one rank in a collated file */
+struct CollatedEntry
+{
+    // the world rank of the group leader, which names the data file
+    std::int64_t group = 0;
+    // byte offset of the data of the rank in the data file
+    std::int64_t offset = 0;
+    // the internal values, ie. the cells of volume and the faces of surface fields
+    std::int64_t nCells = 0;
+    std::int64_t nBoundaryFaces = 0;
+    std::int64_t valueBytes = 0;
+
+    std::int64_t nBytes() const { return (nCells + nBoundaryFaces) * valueBytes; }
+};
+
+/*@brief writes NeoN fields of decomposed runs into one file per group of ranks
+ *
+ * @details instead of one processorN/<time>/<field> file per rank, the ranks of a group write
+ * their internal and boundary values collectively with MPI-IO into
+ * <case>/collated/<time>/<field>.<group>, where the group is named by the world rank of its
+ * leader. Groups are the ranks sharing a node, or consecutive blocks of groupSize ranks.
+ * <field>.index lists the group, byte offset and sizes of every world rank, hence reading back
+ * only requires the same decomposition, not the same grouping.
+ * Serial runs write a single group without MPI.
+ */
+class CollatedWriter
+{
+public:
+
+    /* @param groupSize ranks per file, zero or less groups the ranks sharing a node */
+    CollatedWriter(const Foam::Time& runTime, int groupSize);
+
+    ~CollatedWriter();
+
+    CollatedWriter(const CollatedWriter&) = delete;
+
+    CollatedWriter& operator=(const CollatedWriter&) = delete;
+
+    /* @brief the directory of the collated files of the current time */
+    std::filesystem::path directory() const;
+
+    /* @brief whether the field was written collated for the current time */
+    bool contains(const std::string& fieldName) const;
+
+    /* @brief writes the internal and boundary values of the field for the current time */
+    template<typename ValueType>
+    void write(const fvcc::VolumeField<ValueType>& field, const std::string& fieldName) const
+    {
+        writeValues(field.internalVector(), field.boundaryData().value(), fieldName);
+    }
+
+    /* @brief writes the face and boundary values of the field for the current time */
+    template<typename ValueType>
+    void write(const fvcc::SurfaceField<ValueType>& field, const std::string& fieldName) const
+    {
+        writeValues(field.internalVector(), field.boundaryData().value(), fieldName);
+    }
+
+    /* @brief reads the internal and boundary values of the field of the current time
+     * @return false if the field was not written collated for the current time
+     */
+    template<typename ValueType>
+    bool read(fvcc::VolumeField<ValueType>& field, const std::string& fieldName) const
+    {
+        return readValues(field.internalVector(), field.boundaryData().value(), fieldName);
+    }
+
+    /* @brief reads the face and boundary values of the field of the current time
+     * @return false if the field was not written collated for the current time
+     */
+    template<typename ValueType>
+    bool read(fvcc::SurfaceField<ValueType>& field, const std::string& fieldName) const
+    {
+        return readValues(field.internalVector(), field.boundaryData().value(), fieldName);
+    }
+
+private:
+
+    template<typename ValueType>
+    void writeValues(
+        const NeoN::Vector<ValueType>& internalValues,
+        const NeoN::Vector<ValueType>& boundaryValues,
+        const std::string& fieldName
+    ) const
+    {
+        ScopedTimer timer("collatedWrite");
+        auto internal = internalValues.copyToHost();
+        auto boundary = boundaryValues.copyToHost();
+        auto [internalView, boundaryView] = views(internal, boundary);
+        std::vector<ValueType> values(internal.size() + boundary.size());
+        auto end = std::copy(internalView.begin(), internalView.end(), values.begin());
+        std::copy(boundaryView.begin(), boundaryView.end(), end);
+        writeBytes(
+            fieldName,
+            reinterpret_cast<const char*>(values.data()),
+            {.nCells = static_cast<std::int64_t>(internal.size()),
+             .nBoundaryFaces = static_cast<std::int64_t>(boundary.size()),
+             .valueBytes = sizeof(ValueType)}
+        );
+    }
+
+    template<typename ValueType>
+    bool readValues(
+        NeoN::Vector<ValueType>& internalValues,
+        NeoN::Vector<ValueType>& boundaryValues,
+        const std::string& fieldName
+    ) const
+    {
+        ScopedTimer timer("collatedRead");
+        const std::size_t nCells = internalValues.size();
+        const std::size_t nBoundaryFaces = boundaryValues.size();
+        std::vector<ValueType> values(nCells + nBoundaryFaces);
+        const bool found = readBytes(
+            fieldName,
+            reinterpret_cast<char*>(values.data()),
+            {.nCells = static_cast<std::int64_t>(nCells),
+             .nBoundaryFaces = static_cast<std::int64_t>(nBoundaryFaces),
+             .valueBytes = sizeof(ValueType)}
+        );
+        if (!found) return false;
+
+        const auto exec = internalValues.exec();
+        internalValues = NeoN::Vector<ValueType>(exec, values.data(), nCells);
+        boundaryValues = NeoN::Vector<ValueType>(exec, values.data() + nCells, nBoundaryFaces);
+        return true;
+    }
+
+    void writeBytes(const std::string& fieldName, const char* data, CollatedEntry local) const;
+
+    bool readBytes(const std::string& fieldName, char* data, CollatedEntry local) const;
+
+    const Foam::Time& runTime_;
+
+    bool parallel_;
+
+    MPI_Comm groupComm_ = MPI_COMM_NULL;
+
+    int group_ = 0;
+};
+
+/* @brief converts a collated field of the current time back to processorN/<time>/<field>
+ *
+ * @details reads the collated values into the field and writes them with FoamAdapter::write,
+ * which OpenFOAM tools like reconstructPar read
+ */
+template<typename ValueType>
+void writeDecomposed(
+    const CollatedWriter& writer,
+    fvcc::VolumeField<ValueType>& field,
+    const Foam::fvMesh& mesh,
+    const std::string& fieldName
+)
+{
+    if (!writer.read(field, fieldName))
+    {
+        Foam::FatalError << "no collated field " << fieldName << " in "
+                         << writer.directory().string() << Foam::nl
+                         << Foam::abort(Foam::FatalError);
+    }
+    write(field, mesh, fieldName);
+}
+
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <variant>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief enables the parallel first touch of host buffers, enabled by default
+ *
+ * @details disabled by `firstTouch no;` in the executor subdictionary of the controlDict
+ */
+void enableParallelFirstTouch(bool enable);
+
+/* @brief whether buffers of the executor are first touched by the threads using them
+ *
+ * @details the operating system places a page on the NUMA node of the thread writing it
+ * first. Buffers constructed from a host pointer are filled by a single thread, hence all pages
+ * end up on one socket and the kernels of the other sockets read remote memory. Only the
+ * threaded host executor is affected, serial runs use one thread and device memory is placed
+ * by the device.
+ * @note vectors NeoN creates with a value, eg. the coefficients and right hand side of
+ * NeoN::la::createEmptyLinearSystem, are filled by NeoN::parallelFor and are already first
+ * touched in parallel
+ */
+bool parallelFirstTouch(const NeoN::Executor& exec);
+
+/* @brief copies host data into a new vector, first touched in parallel on the CPU executor
+ *
+ * @details the vector is allocated uninitialized and filled with the static partitioning of
+ * NeoN::parallelFor, hence each page is placed on the socket of the thread that later processes
+ * the same index range
+ */
+template<typename ValueType>
+NeoN::Vector<ValueType>
+firstTouchVector(const NeoN::Executor& exec, const ValueType* data, std::size_t size)
+{
+    if (!parallelFirstTouch(exec))
+    {
+        return NeoN::Vector<ValueType>(exec, data, size);
+    }
+    NeoN::Vector<ValueType> out(exec, size);
+    auto outView = out.view();
+    NeoN::parallelFor(exec, {0, size}, KOKKOS_LAMBDA(const size_t i) { outView[i] = data[i]; });
+    return out;
+}
+
+/* @brief a new vector of the given value, first touched in parallel on the CPU executor */
+template<typename ValueType>
+NeoN::Vector<ValueType>
+firstTouchVector(const NeoN::Executor& exec, std::size_t size, const ValueType value)
+{
+    if (!parallelFirstTouch(exec))
+    {
+        return NeoN::Vector<ValueType>(exec, size, value);
+    }
+    NeoN::Vector<ValueType> out(exec, size);
+    auto outView = out.view();
+    NeoN::parallelFor(exec, {0, size}, KOKKOS_LAMBDA(const size_t i) { outView[i] = value; });
+    return out;
+}
+
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/linearAlgebra/isotropicLinearSystem.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace FoamAdapter
+{
+
+/* @brief bytes held by the data of a vector */
+template<typename ValueType>
+std::size_t memoryUsage(const NeoN::Vector<ValueType>& vector)
+{
+    return vector.size() * sizeof(ValueType);
+}
+
+/* @brief bytes held by the internal and boundary values of a volume field */
+template<typename ValueType>
+std::size_t memoryUsage(const fvcc::VolumeField<ValueType>& field)
+{
+    const auto& bData = field.boundaryData();
+    return memoryUsage(field.internalVector()) + memoryUsage(bData.value())
+         + memoryUsage(bData.refValue()) + memoryUsage(bData.valueFraction())
+         + memoryUsage(bData.refGrad());
+}
+
+/* @brief bytes held by the matrix and right hand side of a linear system */
+template<typename ValueType, typename IndexType>
+std::size_t memoryUsage(const NeoN::la::LinearSystem<ValueType, IndexType>& ls)
+{
+    const auto& matrix = ls.matrix();
+    return memoryUsage(matrix.values()) + memoryUsage(matrix.colIdxs())
+         + memoryUsage(matrix.rowOffs()) + memoryUsage(ls.rhs());
+}
+
+/* @brief bytes held by the scalar coefficients, sparsity and right hand side */
+template<typename IndexType>
+std::size_t memoryUsage(const IsotropicLinearSystem<IndexType>& ls)
+{
+    return memoryUsage(ls.values()) + memoryUsage(ls.colIdxs()) + memoryUsage(ls.rowOffs())
+         + memoryUsage(ls.rhs());
+}
+
+/* @brief bytes held by the geometry and connectivity of the mesh and its boundary mesh */
+std::size_t memoryUsage(const NeoN::UnstructuredMesh& mesh);
+
+/*@brief accounts the memory of the adapter
+ *
+ * @details Two views of the memory usage are kept:
+ * - the allocations of every Kokkos memory space, recorded by the Kokkos Tools allocation
+ *   callbacks, including temporaries, old time fields and solver workspaces. The current usage,
+ *   the high water mark of the run and of the current time step are kept per memory space.
+ * - named objects, ie. fields, mesh arrays and linear systems, registered by track(). Their
+ *   size is the last one reported.
+ * Disabled by default, enabled by the `-memoryReport` option of the example solvers.
+ * @note enabling installs the allocation callbacks, which replaces the ones of a Kokkos tool
+ */
+class MemoryReport
+{
+public:
+
+    static MemoryReport& instance();
+
+    /* @brief enables the report, has to be called before the memory of interest is allocated */
+    void enable();
+
+    bool enabled() const { return enabled_; }
+
+    /* @brief sets the size of a named object */
+    void track(const std::string& category, const std::string& name, std::size_t bytes);
+
+    /* @brief removes a named object, ie. after it has been released */
+    void untrack(const std::string& category, const std::string& name);
+
+    /* @brief prints the high water mark of the time step per memory space and starts a new step */
+    void sample(std::ostream& os, const std::string& timeName);
+
+    /* @brief prints the high water mark per memory space and the breakdown by named object */
+    void print(std::ostream& os) const;
+
+    /* @brief the high water mark of a memory space in bytes, eg. Host or Cuda */
+    std::size_t peak(const std::string& space) const;
+
+    void allocate(const std::string& space, std::uint64_t bytes);
+
+    void deallocate(const std::string& space, std::uint64_t bytes);
+
+private:
+
+    struct SpaceUsage
+    {
+        std::size_t current = 0;
+        std::size_t peak = 0;
+        std::size_t stepPeak = 0;
+        std::size_t nAllocations = 0;
+    };
+
+    MemoryReport() = default;
+
+    bool enabled_ = false;
+
+    std::map<std::string, SpaceUsage> spaces_ {};
+
+    std::map<std::pair<std::string, std::string>, std::size_t> objects_ {};
+};
+
+/* @brief registers the arrays of the mesh with the memory report, if enabled */
+void trackMemory(const NeoN::UnstructuredMesh& mesh);
+
+/* @brief registers the field with the memory report, if enabled */
+template<typename ValueType>
+void trackMemory(const fvcc::VolumeField<ValueType>& field)
+{
+    auto& report = MemoryReport::instance();
+    if (report.enabled())
+    {
+        report.track("field", field.name, memoryUsage(field));
+    }
+}
+
+}
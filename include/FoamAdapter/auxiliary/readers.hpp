@@ -7,7 +7,10 @@
 #include "NeoN/NeoN.hpp"
 
 #include "FoamAdapter/auxiliary/convert.hpp"
+#include "FoamAdapter/auxiliary/firstTouch.hpp"
 #include "FoamAdapter/auxiliary/type_conversion.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
+#include "FoamAdapter/datastructures/soaField.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 
@@ -19,13 +22,12 @@ auto fromFoamField(const NeoN::Executor& exec, const FoamType& field)
 {
     using type_container_t = typename TypeMap<FoamType>::container_type;
     using mapped_t = typename TypeMap<FoamType>::mapped_type;
-    type_container_t nfField(
+    // the buffers are placed on the NUMA nodes of the threads processing them
+    return firstTouchVector(
         exec,
         reinterpret_cast<const mapped_t*>(field.cdata()),
         static_cast<size_t>(field.size())
     );
-
-    return nfField;
 };
 
 template<typename FoamType>
@@ -91,6 +93,9 @@ auto readVolBoundaryConditions(const NeoN::UnstructuredMesh& nfMesh, const FoamT
         {"calculated", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
         {"extrapolatedCalculated",
          [](auto& dict) { dict.insert("type", std::string("calculated")); }},
+        // the processor faces are set by the HaloExchange
+        {"processor", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
+        {"processorCyclic", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
         {"empty", [](auto& dict) { dict.insert("type", std::string("empty")); }}
     };
 
@@ -114,6 +119,7 @@ auto constructFrom(
     const FoamType& in
 )
 {
+    ScopedTimer timer("constructFrom");
     using type_container_t = typename TypeMap<FoamType>::container_type;
     using type_primitive_t = typename TypeMap<FoamType>::mapped_type;
 
@@ -125,6 +131,19 @@ auto constructFrom(
     return out;
 };
 
+/* @brief constructs a vector volume field in structure of arrays layout
+ * @details the boundary values are evaluated by the boundary conditions of the field
+ */
+template<typename FoamType>
+SoAVolumeField constructSoAFrom(
+    const NeoN::Executor exec,
+    const NeoN::UnstructuredMesh& nfMesh,
+    const FoamType& in
+)
+{
+    return SoAVolumeField(constructFrom(exec, nfMesh, in));
+};
+
 template<typename FoamType>
 auto readSurfaceBoundaryConditions(
     const NeoN::UnstructuredMesh& uMesh,
@@ -158,6 +177,8 @@ auto readSurfaceBoundaryConditions(
              dict.insert("fixedValue", type_primitive_t {});
          }},
         {"calculated", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
+        {"processor", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
+        {"processorCyclic", [](auto& dict) { dict.insert("type", std::string("calculated")); }},
         {"empty", [](auto& dict) { dict.insert("type", std::string("empty")); }}
     };
 
@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2023 FoamAdapter authors
 #pragma once
 
+#include <memory>
 #include <tuple>
 
 #include "NeoN/NeoN.hpp"
@@ -15,7 +16,45 @@ namespace FoamAdapter
 /*@brief based on the Courant number this function synchronizes the deltaT value in both runtimes*/
 void setDeltaT(Foam::Time& ofRunTime, RunTime& nfRunTime, Foam::scalar coNum);
 
-/* @brief create a NeoN executor from a dictionary
+/* @brief the executor settings of the controlDict
+ *
+ * @details either the bare executor name, eg. `executor CPU;`, or a subdictionary
+ *
+ *     executor
+ *     {
+ *         type        CPU;    // Serial, CPU or GPU
+ *         numThreads  32;     // host threads, by default all available
+ *         device      0;      // GPU of the process, by default chosen by Kokkos
+ *         firstTouch  yes;    // place host buffers on the NUMA nodes of the using threads
+ *     }
+ */
+struct ExecutorSettings
+{
+    Foam::word type;
+    Foam::label numThreads = 0;
+    Foam::label device = -1;
+    bool firstTouch = true;
+};
+
+/* @brief reads the executor word or subdictionary of the controlDict */
+ExecutorSettings readExecutorSettings(const Foam::dictionary& controlDict);
+
+/* @brief initializes Kokkos with the executor settings of the case
+ *
+ * @details reads system/controlDict of the case, ie. of the -case argument or the working
+ * directory, before the OpenFOAM objects exist and passes the thread count and device
+ * through the KOKKOS_ environment variables. Hence the threads are placed before the mesh is read
+ * and first touch its arrays where they are used. Variables already set in the environment and
+ * the Kokkos command line arguments take precedence.
+ * @note the OpenMP runtime reads OMP_PROC_BIND and OMP_PLACES when it is loaded, ie. before main,
+ * hence the thread binding has to be set in the environment of the job, eg.
+ *     export OMP_PROC_BIND=spread OMP_PLACES=cores
+ * A binding in effect after the initialization that differs from OMP_PROC_BIND is reported.
+ * @note call instead of Kokkos::initialize at the start of main
+ */
+void initializeKokkos(int& argc, char* argv[]);
+
+/* @brief create a NeoN executor from the executor word or subdictionary of a dictionary
  * @return the Neon::Executor
  */
 NeoN::Executor createExecutor(const Foam::dictionary& dict);
@@ -25,6 +64,18 @@ NeoN::Executor createExecutor(const Foam::dictionary& dict);
  */
 NeoN::Executor createExecutor(const Foam::word& execName);
 
+/* @brief create the solver telemetry if `solverTelemetry yes;` is set in the controlDict
+ * @return the telemetry writer or nullptr if disabled
+ */
+std::shared_ptr<SolverTelemetry> createSolverTelemetry(const Foam::Time& runTime);
+
+/* @brief create the collated writer if `collatedWrite yes;` is set in the controlDict
+ *
+ * @details `collatedGroupSize N;` sets the ranks per file, by default the ranks of a node
+ * @return the writer or nullptr if disabled
+ */
+std::shared_ptr<CollatedWriter> createCollatedWriter(const Foam::Time& runTime);
+
 /* @brief create the commonly required objects for a simulation
  * @return a tuple of the executor, the controlDict, the schemesDict, the  solutionDict*/
 RunTime createAdapterRunTime(const Foam::Time& runTime, const NeoN::Executor exec);
@@ -33,4 +84,24 @@ RunTime createAdapterRunTime(const Foam::Time& runTime, const NeoN::Executor exe
  * @return the RunTime instance*/
 RunTime createAdapterRunTime(const Foam::Time& runTime);
 
+/* @brief prints the execution time of the OpenFOAM runTime and, if enabled by
+ * `timingTree yes;` in the controlDict, the timing tree of the adapter regions
+ * @note intended for the end of the run, during the run use runTime.printExecutionTime
+ */
+void printExecutionTime(const Foam::Time& runTime);
+
+/* @brief adds the -memoryReport option, call before the argList is constructed */
+void addMemoryReportOption();
+
+/* @brief enables the memory report if -memoryReport is given
+ * @note call before the mesh and fields are created, their allocations are not accounted otherwise
+ */
+void enableMemoryReport(const Foam::argList& args);
+
+/* @brief prints the memory high water mark of the time step, if the memory report is enabled */
+void printMemoryUsage(const Foam::Time& runTime);
+
+/* @brief prints the memory breakdown by memory space and named object, if enabled */
+void printMemoryReport();
+
 } // namespace Foam
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/auxiliary/timing.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief timings of a single solve in seconds
+ *
+ * @details the preconditioner setup is only available for the solvers implemented in FoamAdapter,
+ * for the NeoN/Ginkgo solvers it is part of the solve time. Equations without FoamAdapter
+ * controls are assembled and solved by a single NeoN call, their assembly is part of the solve
+ * time as well.
+ */
+struct SolveTimings
+{
+    std::optional<NeoN::scalar> assembly {};
+    std::optional<NeoN::scalar> setup {};
+    NeoN::scalar solve = 0.0;
+};
+
+/* @brief performance record of a single solve */
+struct SolveRecord
+{
+    std::string field;
+    NeoN::scalar t = 0.0;
+    NeoN::scalar dt = 0.0;
+    // the Ginkgo solver type or the FoamAdapter solver, ie. batched or mixedPrecision
+    std::string solver;
+    NeoN::localIdx nRows = 0;
+    NeoN::localIdx nNonZeros = 0;
+    NeoN::localIdx nRhs = 1;
+    SolveTimings timings {};
+    NeoN::la::SolverStats stats {};
+
+    /* @brief estimated floating point operations per Krylov iteration
+     *
+     * @details counts the sparse matrix vector products, dot products and vector updates of the
+     * Krylov method, the preconditioner application is not included. Returns zero for solvers
+     * without an estimate, eg. multigrid.
+     */
+    NeoN::scalar flopsPerIteration() const;
+
+    /* @brief the achieved GFLOP/s estimate of the solve, empty without a flop estimate */
+    std::optional<NeoN::scalar> gflops() const;
+};
+
+/* @brief serializes the record as single line JSON object */
+std::string toJson(const SolveRecord& record);
+
+/*@brief writes one JSON line per solve
+ *
+ * @details enabled by `solverTelemetry yes;` in the controlDict, the records are written to
+ * postProcessing/solverTelemetry/<startTime>/solverTelemetry.jsonl of the case, or of the
+ * processor directory in parallel runs.
+ */
+class SolverTelemetry
+{
+public:
+
+    explicit SolverTelemetry(const std::filesystem::path& file);
+
+    void record(const SolveRecord& record);
+
+    const std::filesystem::path& file() const { return file_; }
+
+private:
+
+    std::filesystem::path file_;
+    std::ofstream stream_;
+};
+
+}
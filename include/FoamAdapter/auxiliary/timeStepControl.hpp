@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include "NeoN/NeoN.hpp"
+
+#include "Time.H"
+
+#include "FoamAdapter/datastructures/meshAdapter.hpp"
+#include "FoamAdapter/datastructures/runTime.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace FoamAdapter
+{
+
+/*@brief adjusts the time step to the maximum Courant number without waiting for its reduction
+ *
+ * @details fvcc::computeCoNum returns the Courant number on the host, hence every time step
+ * waits for the face loop and the reduction to finish on the device. start only enqueues both
+ * kernels into a device scalar and returns, the host continues with the remaining work of the
+ * time step, eg. writing, and the next step until setDeltaT copies the single scalar to the
+ * host, which is required to advance the Foam::Time.
+ *
+ *     nf::CourantTimeStepControl coControl(mesh);
+ *     coControl.start(phi, rt.dt);
+ *     while (runTime.loop())
+ *     {
+ *         // enqueue the first kernels of the step
+ *         coControl.setDeltaT(runTime, rt);
+ *         ...
+ *         coControl.start(phi, rt.dt);
+ *     }
+ *
+ * @note the ScopedTimer fences when the timing tree is enabled, hence the overlap is reduced
+ * with `timingTree yes;`
+ */
+class CourantTimeStepControl
+{
+public:
+
+    explicit CourantTimeStepControl(const MeshAdapter& mesh);
+
+    /* @brief enqueues the Courant number computation of the face flux, does not block */
+    void start(const fvcc::SurfaceField<NeoN::scalar>& phi, NeoN::scalar dt);
+
+    /* @brief waits for the Courant number and sets deltaT of both runtimes like setDeltaT
+     * @note requires a preceding start
+     */
+    void setDeltaT(Foam::Time& ofRunTime, RunTime& nfRunTime);
+
+    /* @brief the Courant number of the subdomain of the last setDeltaT */
+    NeoN::scalar coNum() const { return coNum_; }
+
+private:
+
+    const MeshAdapter& mesh_;
+
+    // sum of the absolute face fluxes per cell
+    NeoN::Vector<NeoN::scalar> sumPhi_;
+
+    // the Courant number of the subdomain, written by the device
+    NeoN::Vector<NeoN::scalar> deviceCoNum_;
+
+    NeoN::scalar coNum_ = 0.0;
+
+    bool started_ = false;
+};
+
+}
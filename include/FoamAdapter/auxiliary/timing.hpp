@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief wall clock timer
+ * @note elapsed() fences all executors, so asynchronous device kernels are included
+ */
+class Timer
+{
+public:
+
+    Timer();
+
+    /* @brief seconds since construction */
+    NeoN::scalar elapsed() const;
+
+private:
+
+    std::chrono::steady_clock::time_point start_;
+};
+
+/* @brief a named region of the timing tree with the accumulated time of all its calls */
+struct TimingNode
+{
+    std::string name;
+    NeoN::scalar seconds = 0.0;
+    std::size_t calls = 0;
+    TimingNode* parent = nullptr;
+    std::vector<std::unique_ptr<TimingNode>> children {};
+
+    /* @brief returns the child of the given name, creates it on first use */
+    TimingNode& child(const std::string& childName);
+};
+
+/*@brief hierarchical timing tree of the ScopedTimer regions
+ *
+ * @details regions opened while another region is open become its children, ie. the tree
+ * mirrors the call hierarchy. Disabled by default, enabled by `timingTree yes;` in the
+ * controlDict. The tree is only used from the host thread driving the solver.
+ */
+class TimingTree
+{
+public:
+
+    static TimingTree& instance();
+
+    static bool enabled() { return enabled_; }
+
+    static void enable(bool enabled) { enabled_ = enabled; }
+
+    void push(const std::string& name);
+
+    void pop(NeoN::scalar seconds);
+
+    /* @brief discards all recorded regions */
+    void reset();
+
+    const TimingNode& root() const { return root_; }
+
+    /* @brief prints the time, number of calls and share of the parent region of every region */
+    void print(std::ostream& os) const;
+
+private:
+
+    TimingTree();
+
+    inline static bool enabled_ = false;
+
+    TimingNode root_;
+
+    TimingNode* current_;
+};
+
+/*@brief names the enclosing scope in profiles and the timing tree
+ *
+ * @details Emits a Kokkos profiling region, so the region shows up in Kokkos Tools and in
+ * profilers connected through them. If the timing tree is enabled, the time of the scope is
+ * additionally accumulated in the TimingTree. Without a loaded Kokkos tool and with the tree
+ * disabled the timer only checks two flags.
+ * @note the timing tree fences at the end of each region, so the time of device kernels is
+ * attributed to the region launching them
+ */
+class ScopedTimer
+{
+public:
+
+    explicit ScopedTimer(const char* name);
+
+    explicit ScopedTimer(const std::string& name);
+
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+
+    void start(const std::string& name);
+
+    bool kokkosRegion_;
+
+    bool timed_;
+
+    std::chrono::steady_clock::time_point start_ {};
+};
+
+}
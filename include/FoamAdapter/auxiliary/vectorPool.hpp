@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/auxiliary/memoryReport.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief counters of the vector pools of all value types and executors */
+struct VectorPoolStatistics
+{
+    std::size_t acquires = 0;
+    // acquires served from a cached vector
+    std::size_t hits = 0;
+    std::size_t cachedBytes = 0;
+    std::size_t peakCachedBytes = 0;
+};
+
+/* @brief the pool statistics, printed by the memory report */
+VectorPoolStatistics& vectorPoolStatistics();
+
+/* @brief releases the cached vectors of the pools of all value types
+ *
+ * @details the cached vectors hold executor memory and have to be freed before Kokkos is
+ * finalized, the pools outlive main. Hence the first pool in use registers this function as
+ * Kokkos finalize hook.
+ */
+void clearVectorPools();
+
+namespace detail
+{
+
+/* @brief adds the clear function of a pool to clearVectorPools */
+void registerVectorPool(std::function<void()> clear);
+
+}
+
+/*@brief cache of released vectors of one value type
+ *
+ * @details the size classes are the exact vector sizes per executor. The temporaries of the
+ * adapter are sized by the mesh, ie. by the number of cells, faces or non-zeros, hence few
+ * classes are used and a released vector is reused by the next temporary of the same class
+ * instead of going through the allocator of the executor. The number of cached vectors is
+ * bounded by the number of simultaneously used temporaries of a class.
+ * The pools are only used from the host thread driving the solver.
+ */
+template<typename ValueType>
+class VectorPool
+{
+public:
+
+    static VectorPool& instance()
+    {
+        static VectorPool pool;
+        [[maybe_unused]] static const bool registered =
+            (detail::registerVectorPool([]() { pool.clear(); }), true);
+        return pool;
+    }
+
+    /* @brief a vector of the given size with unspecified values */
+    NeoN::Vector<ValueType> take(const NeoN::Executor& exec, std::size_t size)
+    {
+        auto& stats = vectorPoolStatistics();
+        stats.acquires++;
+        auto& bucket = buckets_[{execName(exec), size}];
+        if (bucket.empty())
+        {
+            return NeoN::Vector<ValueType>(exec, size);
+        }
+        stats.hits++;
+        stats.cachedBytes -= size * sizeof(ValueType);
+        NeoN::Vector<ValueType> vector(std::move(bucket.back()));
+        bucket.pop_back();
+        return vector;
+    }
+
+    /* @brief caches the vector for the next take of the same size and executor */
+    void give(NeoN::Vector<ValueType>&& vector)
+    {
+        auto& stats = vectorPoolStatistics();
+        stats.cachedBytes += vector.size() * sizeof(ValueType);
+        stats.peakCachedBytes = std::max(stats.peakCachedBytes, stats.cachedBytes);
+        buckets_[{execName(vector.exec()), vector.size()}].push_back(std::move(vector));
+    }
+
+    /* @brief releases all cached vectors */
+    void clear()
+    {
+        auto& stats = vectorPoolStatistics();
+        for (auto& [key, bucket] : buckets_)
+        {
+            stats.cachedBytes -= bucket.size() * key.second * sizeof(ValueType);
+        }
+        buckets_.clear();
+    }
+
+private:
+
+    VectorPool() = default;
+
+    static std::string execName(const NeoN::Executor& exec)
+    {
+        return std::visit([](const auto& e) { return std::string(e.name()); }, exec);
+    }
+
+    std::map<std::pair<std::string, std::size_t>, std::vector<NeoN::Vector<ValueType>>>
+        buckets_ {};
+};
+
+/*@brief a vector drawn from the VectorPool and returned to it at the end of scope
+ *
+ * @details access the vector with * or ->, eg. views(*r) or r->view()
+ */
+template<typename ValueType>
+class PooledVector
+{
+public:
+
+    /* @brief a vector with unspecified values */
+    PooledVector(const NeoN::Executor& exec, std::size_t size)
+        : vector_(VectorPool<ValueType>::instance().take(exec, size))
+    {}
+
+    PooledVector(const NeoN::Executor& exec, std::size_t size, const ValueType value)
+        : PooledVector(exec, size)
+    {
+        NeoN::fill(vector_, value);
+    }
+
+    ~PooledVector() { VectorPool<ValueType>::instance().give(std::move(vector_)); }
+
+    PooledVector(const PooledVector&) = delete;
+
+    PooledVector& operator=(const PooledVector&) = delete;
+
+    NeoN::Vector<ValueType>& operator*() { return vector_; }
+
+    const NeoN::Vector<ValueType>& operator*() const { return vector_; }
+
+    NeoN::Vector<ValueType>* operator->() { return &vector_; }
+
+    const NeoN::Vector<ValueType>* operator->() const { return &vector_; }
+
+private:
+
+    NeoN::Vector<ValueType> vector_;
+};
+
+/*@brief cache of released temporary volume fields by field name
+ *
+ * @details the temporaries of the correctors, eg. rAU and HbyA, are whole fields with boundary
+ * conditions. A released field is reused by the next temporary of the same name, hence neither
+ * its values nor its boundary data are allocated again. The pool is owned by the RunTime and thus
+ * destroyed before the mesh the fields refer to. The fields are counted by the
+ * VectorPoolStatistics.
+ */
+class VolumeFieldPool
+{
+public:
+
+    template<typename ValueType>
+    using VolumeField = NeoN::finiteVolume::cellCentred::VolumeField<ValueType>;
+
+    VolumeFieldPool() = default;
+
+    VolumeFieldPool(VolumeFieldPool&&) = default;
+
+    ~VolumeFieldPool() { clear(); }
+
+    /* @brief a released field of the given name or nullptr */
+    template<typename ValueType>
+    std::unique_ptr<VolumeField<ValueType>> take(const std::string& name)
+    {
+        auto& stats = vectorPoolStatistics();
+        stats.acquires++;
+        auto& bucket = fields<ValueType>()[name];
+        if (bucket.empty()) return nullptr;
+        stats.hits++;
+        auto field = std::move(bucket.back());
+        bucket.pop_back();
+        stats.cachedBytes -= memoryUsage(*field);
+        return field;
+    }
+
+    /* @brief caches the field for the next take of the same name */
+    template<typename ValueType>
+    void give(std::unique_ptr<VolumeField<ValueType>> field)
+    {
+        auto& stats = vectorPoolStatistics();
+        stats.cachedBytes += memoryUsage(*field);
+        stats.peakCachedBytes = std::max(stats.peakCachedBytes, stats.cachedBytes);
+        fields<ValueType>()[field->name].push_back(std::move(field));
+    }
+
+    /* @brief releases all cached fields */
+    void clear()
+    {
+        clear(scalarFields_);
+        clear(vectorFields_);
+    }
+
+private:
+
+    template<typename ValueType>
+    using Buckets = std::map<std::string, std::vector<std::unique_ptr<VolumeField<ValueType>>>>;
+
+    template<typename ValueType>
+    Buckets<ValueType>& fields()
+    {
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            return scalarFields_;
+        }
+        else
+        {
+            static_assert(std::is_same_v<ValueType, NeoN::Vec3>);
+            return vectorFields_;
+        }
+    }
+
+    template<typename ValueType>
+    static void clear(Buckets<ValueType>& buckets)
+    {
+        auto& stats = vectorPoolStatistics();
+        for (const auto& [name, bucket] : buckets)
+        {
+            for (const auto& field : bucket)
+            {
+                stats.cachedBytes -= memoryUsage(*field);
+            }
+        }
+        buckets.clear();
+    }
+
+    Buckets<NeoN::scalar> scalarFields_ {};
+
+    Buckets<NeoN::Vec3> vectorFields_ {};
+};
+
+/*@brief a temporary volume field drawn from a VolumeFieldPool and returned to it at the end of
+ * scope
+ *
+ * @details the field is only constructed if the pool holds no released field of the same name,
+ * otherwise the field of an earlier corrector is reused with its boundary conditions and
+ * unspecified values. Access the field with * or ->, eg. constrainHbyA(U, p, *hByA).
+ */
+template<typename ValueType>
+class PooledVolumeField
+{
+public:
+
+    using VolumeField = NeoN::finiteVolume::cellCentred::VolumeField<ValueType>;
+
+    /* @param createBoundaries creates the boundary conditions of a newly constructed field */
+    template<typename CreateBoundaries>
+    PooledVolumeField(
+        VolumeFieldPool& pool,
+        const NeoN::Executor& exec,
+        const std::string& name,
+        const NeoN::UnstructuredMesh& mesh,
+        CreateBoundaries createBoundaries
+    )
+        : pool_(&pool), field_(pool.take<ValueType>(name))
+    {
+        if (!field_)
+        {
+            field_ = std::make_unique<VolumeField>(exec, name, mesh, createBoundaries());
+        }
+    }
+
+    ~PooledVolumeField()
+    {
+        // a moved from handle does not own a field
+        if (field_) pool_->give(std::move(field_));
+    }
+
+    PooledVolumeField(PooledVolumeField&&) = default;
+
+    PooledVolumeField(const PooledVolumeField&) = delete;
+
+    PooledVolumeField& operator=(const PooledVolumeField&) = delete;
+
+    PooledVolumeField& operator=(PooledVolumeField&&) = delete;
+
+    VolumeField& operator*() { return *field_; }
+
+    const VolumeField& operator*() const { return *field_; }
+
+    VolumeField* operator->() { return field_.get(); }
+
+    const VolumeField* operator->() const { return field_.get(); }
+
+private:
+
+    VolumeFieldPool* pool_;
+
+    std::unique_ptr<VolumeField> field_;
+};
+
+}
@@ -8,6 +8,7 @@
 #include "volFields.H"
 
 #include "FoamAdapter/auxiliary/convert.hpp"
+#include "FoamAdapter/datastructures/soaField.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 
@@ -54,4 +55,7 @@ void write(
     const std::string fieldName
 );
 
+/*@brief writes a structure of arrays field back to disk using OF field file format*/
+void write(const SoAVolumeField& volField, const Foam::fvMesh& mesh, const std::string fieldName);
+
 } // namespace Foam
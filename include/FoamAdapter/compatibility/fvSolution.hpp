@@ -7,7 +7,10 @@
  */
 #pragma once
 
+#include <string>
+
 #include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/label.hpp"
 
 
 namespace FoamAdapter
@@ -17,6 +20,63 @@ void updateSolver(NeoN::Dictionary& solverDict);
 
 void updatePreconditioner(NeoN::Dictionary& solverDict);
 
+/* @brief translates an OpenFOAM preconditioner into a Ginkgo preconditioner configuration
+ *
+ * @details supported are
+ * - DIC: incomplete Cholesky with a ParIC factorization, `nSweeps` sets the number of
+ *   factorization sweeps. Incomplete Cholesky requires a positive diagonal, hence the PDESolver
+ *   solves -A x = -b for a negative definite system, eg. the pressure equation. The factorization
+ *   is computed in every solve, since the coefficients change with every corrector, which costs
+ *   `nSweeps` passes over the matrix values in addition to the solve
+ * - DILU: incomplete LU with a ParILU factorization
+ * - diagonal: scalar Jacobi
+ * - blockJacobi: block Jacobi with blocks of up to `maxBlockSize` (default 8, at most 32)
+ *   consecutive cells, ie. the blocks follow the cell numbering of the mesh
+ * - GAMG: see mapGAMG
+ * @param controls the OpenFOAM preconditioner sub dictionary or an empty dictionary
+ */
+NeoN::Dictionary
+mapPreconditioner(const std::string& preconditionerName, const NeoN::Dictionary& controls);
+
 NeoN::Dictionary mapFvSolution(const NeoN::Dictionary& solverDict);
 
+/* @brief translates the OpenFOAM GAMG entries into a Ginkgo multigrid configuration
+ *
+ * @details maps `smoother`, `nPreSweeps`/`nPostSweeps`, `nCellsInCoarsestLevel` and `maxLevels`
+ * to the smoothers and coarsening of a V-cycle with parallel graph match agglomeration. The
+ * returned dictionary holds neither `type` nor `criteria`, so it can be used as solver or as
+ * preconditioner. A smoother with zero sweeps, eg. the default `nPreSweeps 0`, is omitted. The
+ * DIC and DICGaussSeidel smoothers are replaced by symmetric Gauss-Seidel, since an incomplete
+ * Cholesky smoother breaks down on the negative definite pressure equation.
+ */
+NeoN::Dictionary mapGAMG(const NeoN::Dictionary& gamgDict);
+
+/* @brief reads an OpenFOAM switch entry
+ *
+ * @details after conversion from a Foam::dictionary a switch is either stored as bool or as
+ * word, ie. yes/no, on/off, true/false
+ */
+bool readSwitch(const NeoN::Dictionary& dict, const std::string& key, bool defaultValue);
+
+/* @brief reads an integer entry
+ *
+ * @details depending on its origin an integer is either stored as int or as NeoN::label
+ */
+NeoN::localIdx
+readIndex(const NeoN::Dictionary& dict, const std::string& key, NeoN::localIdx defaultValue);
+
+/* @brief whether the solver dictionary or one of its sub dictionaries has the given type
+ *
+ * @details used to find a Ginkgo component anywhere in the solver configuration, eg. an
+ * incomplete Cholesky preconditioner
+ */
+bool containsType(const NeoN::Dictionary& solverDict, const std::string& type);
+
+/* @brief returns a copy of the solver dictionary without the FoamAdapter specific controls
+ *
+ * @details entries like `batched`, `isotropic` or `initialGuess` are handled by FoamAdapter itself
+ * and must not be passed on to the NeoN/Ginkgo solver
+ */
+NeoN::Dictionary removeAdapterControls(const NeoN::Dictionary& solverDict);
+
 } // namespace FoamAdapter
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/*@brief the index type of the connectivity and CSR column indices owned by the adapter
+ *
+ * @details cell and face indices of a rank fit into 32 bit, even for builds with 64 bit labels,
+ * hence the face loops and sparse matrix products of the adapter read half the index bytes.
+ * Offsets into the non-zeros, ie. the CSR row offsets, keep NeoN::localIdx. Selected at compile
+ * time by the FOAMADAPTER_COMPACT_INDEX CMake option, disabled by default.
+ * @note the NeoN mesh and systems keep their NeoN::localIdx indices, the narrowed indices are
+ * copies and add to the memory usage
+ */
+#ifdef FOAMADAPTER_COMPACT_INDEX
+using connectivityIdx = std::int32_t;
+#else
+using connectivityIdx = NeoN::localIdx;
+#endif
+
+/* @brief the face to cell connectivity of the adapter kernels
+ * @note same layout as the NeoN::UnstructuredMesh, ie. the owner of all faces and the neighbour
+ * of the internal faces
+ */
+struct Connectivity
+{
+    NeoN::Vector<connectivityIdx> faceOwner;
+
+    NeoN::Vector<connectivityIdx> faceNeighbour;
+
+    // the adjacent cell of all boundary faces, in the order of the NeoN::BoundaryMesh
+    NeoN::Vector<connectivityIdx> faceCells;
+};
+
+/* @brief converts the indices to IndexType
+ * @note the values have to fit into IndexType, ie. be cell indices of a mesh accepted by
+ * readConnectivity
+ */
+template<typename IndexType, typename InIndexType>
+NeoN::Vector<IndexType> narrowIndices(const NeoN::Vector<InIndexType>& in)
+{
+    if constexpr (std::is_same_v<IndexType, InIndexType>)
+    {
+        return in;
+    }
+    else
+    {
+        NeoN::Vector<IndexType> out(in.exec(), in.size());
+        const auto inView = in.view();
+        out.apply(KOKKOS_LAMBDA(const size_t i) { return static_cast<IndexType>(inView[i]); });
+        return out;
+    }
+}
+
+}
@@ -4,10 +4,25 @@
 
 #pragma once
 
+#include <iostream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "NeoN/NeoN.hpp"
 
 #include "FoamAdapter/datastructures/runTime.hpp"
 #include "FoamAdapter/compatibility/fvSolution.hpp"
+#include "FoamAdapter/auxiliary/memoryReport.hpp"
+#include "FoamAdapter/auxiliary/solverTelemetry.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
+#include "FoamAdapter/linearAlgebra/batchedSolver.hpp"
+#include "FoamAdapter/linearAlgebra/initialGuess.hpp"
+#include "FoamAdapter/linearAlgebra/mixedPrecisionSolver.hpp"
+#include "FoamAdapter/linearAlgebra/isotropicLinearSystem.hpp"
+#include "FoamAdapter/linearAlgebra/subdomainCoupling.hpp"
 
 namespace dsl = NeoN::dsl;
 
@@ -33,10 +48,11 @@ public:
         , expr_(expr)
         , runTime_(runTime)
         , sparsityPattern_(NeoN::la::SparsityPattern::readOrCreate(psi.mesh()))
-        , ls_(NeoN::la::createEmptyLinearSystem<ValueType, NeoN::localIdx>(
+        , ls_(NeoN::la::createEmptyLinearSystem<ValueType, IndexType>(
               psi.mesh(),
               sparsityPattern_
           ))
+        , isotropic_(readIsotropic(runTime, psi.name))
     {
         expr_.read(runTime_.fvSchemesDict);
     };
@@ -46,7 +62,9 @@ public:
         , expr_(expr.expr_)
         , runTime_(expr.runTime_)
         , ls_(expr.ls_)
-        , sparsityPattern_(expr.sparsityPattern_) {};
+        , sparsityPattern_(expr.sparsityPattern_)
+        , isotropic_(expr.isotropic_)
+        , isoLs_(expr.isoLs_) {};
 
     ~PDESolver() = default;
 
@@ -54,6 +72,8 @@ public:
 
     const VolumeField& getField() const { return this->psi_; }
 
+    const RunTime& runTime() const { return runTime_; }
+
     [[nodiscard]] const NeoN::la::SparsityPattern& sparsityPattern() const
     {
         return sparsityPattern_;
@@ -66,9 +86,40 @@ public:
         return ls_;
     }
 
+    /* @brief whether the coefficients are stored as isotropic scalar system
+     *
+     * @details enabled by `isotropic yes;` in the solver dictionary of a Vec3 field
+     * @note an isotropic system is always solved by the batched solver, see readIsotropic
+     */
+    [[nodiscard]] bool isotropic() const { return isotropic_; }
+
+    /* @brief the assembled isotropic system
+     * @note only available for isotropic equations after assembly
+     */
+    [[nodiscard]] const IsotropicLinearSystem<IndexType>& isotropicSystem() const
+    {
+        if (!isoLs_)
+        {
+            throw std::runtime_error("isotropic system of " + psi_.name + " is not assembled");
+        }
+        return *isoLs_;
+    }
+
+    /* @brief assembles the linear system
+     * @note for isotropic equations the coefficients are moved to the isotropicSystem and the
+     * returned Vec3 system does not hold any matrix values
+     */
     NeoN::la::LinearSystem<ValueType, IndexType>& assemble()
     {
+        ScopedTimer timer("PDESolver::assemble(" + psi_.name + ")");
+        if (isotropic_)
+        {
+            assembleIsotropic();
+            trackLinearSystem();
+            return ls_;
+        }
         expr_.assemble(runTime_.t, runTime_.dt, sparsityPattern_, ls_);
+        trackLinearSystem();
         return ls_;
     }
 
@@ -112,6 +163,48 @@ public:
         }
     };
 
+    /* @brief solves -A x = -b instead of A x = b if the diagonal of A is negative
+     *
+     * @details the incomplete Cholesky preconditioner requires a positive diagonal, while the
+     * pressure equation laplacian(rAU, p) - div(phiHbyA) is negative definite. Negating the
+     * system keeps the solution and the residual norms. Systems with a positive or mixed sign
+     * diagonal are left untouched.
+     * @note the assembled system is read after the solve, eg. by updateFaceVelocity, hence
+     * PDESolver::solve negates it back once solved. The functor records the negation in the
+     * flag it is constructed with.
+     */
+    template<typename FunctorValueType>
+    struct NegateNegativeDefinite : public NeoN::dsl::PostAssemblyBase<ValueType>
+    {
+        bool* negated_;
+
+        NegateNegativeDefinite(bool* negated) : negated_(negated) {}
+
+        virtual void operator()(
+            const NeoN::la::SparsityPattern& sp,
+            NeoN::la::LinearSystem<FunctorValueType, NeoN::localIdx>& ls
+        )
+        {
+            const auto diagOffset = sp.diagOffset().view();
+            const auto rowOffs = ls.matrix().rowOffs().view();
+            const auto values = ls.matrix().values().view();
+
+            NeoN::scalar nNonNegative = 0.0;
+            NeoN::parallelReduce(
+                ls.exec(),
+                {0, diagOffset.size()},
+                KOKKOS_LAMBDA(const NeoN::localIdx celli, NeoN::scalar& sum) {
+                    sum += (values[rowOffs[celli] + diagOffset[celli]] < 0.0) ? 0.0 : 1.0;
+                },
+                nNonNegative
+            );
+            if (nNonNegative > 0.0) return;
+
+            negate(ls);
+            *negated_ = true;
+        }
+    };
+
     void setReference(NeoN::localIdx pRefCell, NeoN::scalar pRefValue)
     {
         needReference_ = true;
@@ -122,40 +215,101 @@ public:
     // TODO unify with dsl/solver.hpp
     NeoN::la::SolverStats solve()
     {
-        // Only if ValueType is scalar
-        auto functs = std::vector<NeoN::dsl::PostAssemblyBase<ValueType>> {};
+        ScopedTimer timer("PDESolver::solve(" + psi_.name + ")");
 
-        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        // FIXME TODO this will create the sparsity pattern and potentially the ls
+        // again even if it has been created already
+        auto fieldSolverDict = this->fieldSolverDict();
+        const bool batched = isBatched(fieldSolverDict);
+        const auto guessControls = InitialGuessControls::read(fieldSolverDict);
+        const bool withGuess = guessControls.type != InitialGuessType::previous;
+        const bool mixedPrecision = readSwitch(fieldSolverDict, "mixedPrecision", false);
+        auto functs = postAssembly(fieldSolverDict, &negated_);
+
+        NeoN::la::SolverStats stats {};
+        InitialGuessStats guessStats {};
+        SolveTimings timings {};
+        const bool decomposed = !runTime_.mesh.processorInterfaces().empty();
+        NeoN::localIdx nCouplingIter = 0;
+        if (decomposed)
+        {
+            std::tie(stats, guessStats) = solveCoupled(
+                fieldSolverDict,
+                guessControls,
+                batched,
+                mixedPrecision,
+                functs,
+                timings,
+                nCouplingIter
+            );
+        }
+        else if (batched)
+        {
+            stats = solveBatched(fieldSolverDict, timings);
+        }
+        else if (withGuess || mixedPrecision)
         {
-            functs =
-                needReference_
-                    ? std::vector<NeoN::dsl::PostAssemblyBase<ValueType>> {SetReference<ValueType>(
-                          pRefCell_,
-                          pRefValue_
-                      )}
-                    : std::vector<NeoN::dsl::PostAssemblyBase<ValueType>> {};
+            std::tie(stats, guessStats) =
+                solveAssembled(fieldSolverDict, guessControls, mixedPrecision, functs, timings);
+        }
+        else
+        {
+            // NeoN assembles and solves in one call, the solve time includes the assembly
+            Timer solveTimer;
+            stats = NeoN::dsl::detail::iterativeSolveImpl(
+                expr_,
+                sparsityPattern_,
+                ls_,
+                psi_,
+                runTime_.t,
+                runTime_.dt,
+                runTime_.fvSchemesDict,
+                removeAdapterControls(fieldSolverDict),
+                functs
+            );
+            timings.solve = elapsed(solveTimer);
         }
 
-        // FIXME TODO this will create the sparsity pattern and potentially the ls
-        // again even if it has been created already
-        auto solverDict = runTime_.fvSolutionDict.get<NeoN::Dictionary>("solvers");
-        auto fieldSolverDict = solverDict.get<NeoN::Dictionary>(psi_.name);
-        auto stats = NeoN::dsl::detail::iterativeSolveImpl(
-            expr_,
-            sparsityPattern_,
-            ls_,
-            psi_,
-            runTime_.t,
-            runTime_.dt,
-            runTime_.fvSchemesDict,
-            fieldSolverDict,
-            functs
-        );
+        // the assembled system keeps its sign for the flux and the next solve
+        if (negated_)
+        {
+            negate(ls_);
+            negated_ = false;
+        }
+
+        trackLinearSystem();
+        if (runTime_.telemetry)
+        {
+            runTime_.telemetry->record(SolveRecord {
+                .field = psi_.name,
+                .t = runTime_.t,
+                .dt = runTime_.dt,
+                .solver = solverType(fieldSolverDict, batched, mixedPrecision),
+                .nRows = psi_.internalVector().size(),
+                .nNonZeros = ls_.matrix().colIdxs().size(),
+                .nRhs = std::is_same_v<ValueType, NeoN::Vec3> ? 3 : 1,
+                .timings = timings,
+                .stats = stats
+            });
+        }
 
-        std::cout << "[NeoN] Solving for " << psi_.name << ":"
+        std::cout << "[NeoN] Solving for " << psi_.name
+                  << (isotropic_ ? " (isotropic, batched)" : (batched ? " (batched)" : ""))
+                  << (mixedPrecision && !batched ? " (mixed precision)" : "") << ":"
                   << " Initial residual: " << stats.initResNorm
                   << " Final residual: " << stats.finalResNorm
-                  << " No Iterations: " << stats.numIter << std::endl;
+                  << " No Iterations: " << stats.numIter;
+        if (decomposed)
+        {
+            std::cout << " Coupling iterations: " << nCouplingIter;
+        }
+        if (withGuess && !batched)
+        {
+            std::cout << " Initial guess: " << name(guessControls.type)
+                      << " Guess residual ratio: " << guessStats.residualRatio()
+                      << " Iterations saved: " << guessStats.iterationsSaved(stats);
+        }
+        std::cout << std::endl;
         return stats;
     }
 
@@ -165,17 +319,467 @@ public:
         return solve();
     }
 
+    /* @brief a copy of the assembled system with the reference and sign change applied by solve
+     *
+     * @details solve applies both after every assembly. The copy allows to time or repeat the
+     * linear solve of an assembled system on its own, while the assembled system read by eg.
+     * updateFaceVelocity keeps its sign.
+     */
+    NeoN::la::LinearSystem<ValueType, IndexType> constrainedSystem() const
+    {
+        auto ls = ls_;
+        bool negated = false;
+        for (auto& funct : postAssembly(fieldSolverDict(), &negated))
+        {
+            funct(sparsityPattern_, ls);
+        }
+        return ls;
+    }
+
 private:
 
+    NeoN::Dictionary fieldSolverDict() const
+    {
+        return runTime_.fvSolutionDict.get<NeoN::Dictionary>("solvers").get<NeoN::Dictionary>(
+            psi_.name
+        );
+    }
+
+    /* @brief the functors applied to the assembled system before it is solved
+     * @param negated set by NegateNegativeDefinite if it negated the system
+     */
+    std::vector<NeoN::dsl::PostAssemblyBase<ValueType>>
+    postAssembly(const NeoN::Dictionary& fieldSolverDict, bool* negated) const
+    {
+        auto functs = std::vector<NeoN::dsl::PostAssemblyBase<ValueType>> {};
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            if (needReference_)
+            {
+                functs.push_back(SetReference<ValueType>(pRefCell_, pRefValue_));
+            }
+            if (containsType(fieldSolverDict, "preconditioner::Ic"))
+            {
+                functs.push_back(NegateNegativeDefinite<ValueType>(negated));
+            }
+        }
+        return functs;
+    }
+
+    /* @brief whether the components of a Vec3 equation are solved as one multi rhs system
+     *
+     * @details enabled by `batched yes;` in the solver dictionary of the field
+     */
+    bool isBatched(const NeoN::Dictionary& fieldSolverDict) const
+    {
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            // the isotropic system is always solved by the batched solver
+            return isotropic_ || readSwitch(fieldSolverDict, "batched", false);
+        }
+        return false;
+    }
+
+    NeoN::la::SolverStats
+    solveBatched(const NeoN::Dictionary& fieldSolverDict, SolveTimings& timings)
+    {
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            Timer assemblyTimer;
+            assemble();
+            timings.assembly = elapsed(assemblyTimer);
+
+            ScopedTimer timer("linearSolve");
+            Timer solveTimer;
+            NeoN::scalar setupTime = 0.0;
+            auto* setupTimePtr = runTime_.telemetry ? &setupTime : nullptr;
+            auto& x = psi_.internalVector();
+            auto stats = isotropic_ ? batchedSolve(*isoLs_, x, fieldSolverDict, setupTimePtr)
+                                    : batchedSolve(ls_, x, fieldSolverDict, setupTimePtr);
+            timings.solve = elapsed(solveTimer);
+            timings.setup = setupTime;
+            psi_.correctBoundaryConditions();
+            return stats;
+        }
+        throw std::runtime_error("batched solve is only available for Vec3 equations");
+    }
+
+    /* @brief assembles, replaces the solution by the initial guess and solves
+     *
+     * @details Used for the equation controls that need access to the assembled system:
+     * - `initialGuess extrapolate;` or `initialGuess projection;`, the solution history is kept
+     *   by the RunTime, since the PDESolver is usually recreated for every corrector.
+     * - `mixedPrecision yes;`, solves by iterative refinement with single precision corrections
+     * The initial guess and the mixed precision solver are only available for scalar equations.
+     */
+    std::pair<NeoN::la::SolverStats, InitialGuessStats> solveAssembled(
+        const NeoN::Dictionary& fieldSolverDict,
+        const InitialGuessControls& guessControls,
+        bool mixedPrecision,
+        std::vector<NeoN::dsl::PostAssemblyBase<ValueType>>& functs,
+        SolveTimings& timings
+    )
+    {
+        const bool withGuess = guessControls.type != InitialGuessType::previous;
+        if (!std::is_same_v<ValueType, NeoN::scalar> && (withGuess || mixedPrecision))
+        {
+            throw std::runtime_error(
+                "initialGuess and mixedPrecision are only available for scalar equations"
+            );
+        }
+
+        {
+            ScopedTimer timer("PDESolver::assemble(" + psi_.name + ")");
+            Timer assemblyTimer;
+            expr_.assemble(runTime_.t, runTime_.dt, sparsityPattern_, ls_);
+            for (auto& funct : functs)
+            {
+                funct(sparsityPattern_, ls_);
+            }
+            timings.assembly = elapsed(assemblyTimer);
+        }
+        ScopedTimer timer("linearSolve");
+
+        InitialGuessStats guessStats {};
+        NeoN::la::SolverStats stats {};
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            auto& history = runTime_.initialGuesses[psi_.name];
+            if (withGuess)
+            {
+                guessStats = history.apply(guessControls, ls_, runTime_.t, psi_.internalVector());
+            }
+
+            Timer solveTimer;
+            if (mixedPrecision)
+            {
+                Timer setupTimer;
+                const auto& matrix = updateSinglePrecisionMatrix();
+                timings.setup = elapsed(setupTimer);
+                stats = mixedPrecisionSolve(ls_, psi_.internalVector(), fieldSolverDict, matrix);
+            }
+            else
+            {
+                stats = NeoN::la::Solver(psi_.exec(), removeAdapterControls(fieldSolverDict))
+                            .solve(ls_, psi_.internalVector());
+            }
+            timings.solve = elapsed(solveTimer);
+
+            if (withGuess)
+            {
+                history.store(guessControls, runTime_.t, psi_.internalVector());
+            }
+        }
+        else
+        {
+            Timer solveTimer;
+            stats = NeoN::la::Solver(psi_.exec(), removeAdapterControls(fieldSolverDict))
+                        .solve(ls_, psi_.internalVector());
+            timings.solve = elapsed(solveTimer);
+        }
+        psi_.correctBoundaryConditions();
+        return {stats, guessStats};
+    }
+
+    /* @brief solves a decomposed equation, iterating the coupling of the subdomains
+     *
+     * @details The processor faces couple the subdomains through the neighbour cell values, which
+     * enter the assembled system like fixed values. Each coupling iteration solves all subdomains
+     * with these values, exchanges the new values and reassembles the system, ie. one additive
+     * Schwarz iteration. Its residual norm over all ranks is the residual of the undecomposed
+     * system, the iteration stops once it meets the tolerances of the solver dictionary or after
+     * `maxCouplingIter` iterations. The converged solution is thus the one of a serial run.
+     * @note the subdomains are not coupled by a distributed matrix and the iteration is not
+     * accelerated by a Krylov method. Information crosses one subdomain per iteration, hence
+     * the number of coupling iterations of elliptic equations like the pressure grows with the
+     * number of ranks and the mesh size. An iteration stopped by `maxCouplingIter` above the
+     * tolerance is reported by warnUnconverged.
+     * @return the solver statistics with the global residual norms and the largest number of
+     * subdomain iterations of all ranks
+     */
+    std::pair<NeoN::la::SolverStats, InitialGuessStats> solveCoupled(
+        const NeoN::Dictionary& fieldSolverDict,
+        const InitialGuessControls& guessControls,
+        bool batched,
+        bool mixedPrecision,
+        std::vector<NeoN::dsl::PostAssemblyBase<ValueType>>& functs,
+        SolveTimings& timings,
+        NeoN::localIdx& nCouplingIter
+    )
+    {
+        const bool withGuess = guessControls.type != InitialGuessType::previous;
+        if (!std::is_same_v<ValueType, NeoN::scalar> && (withGuess || mixedPrecision))
+        {
+            throw std::runtime_error(
+                "initialGuess and mixedPrecision are only available for scalar equations"
+            );
+        }
+        const auto criteria = SolverCriteria::read(fieldSolverDict);
+        const auto controls = CouplingControls::read(fieldSolverDict);
+        const auto subdomainDict = subdomainSolverDict(fieldSolverDict);
+
+        Timer assemblyTimer;
+        assembleSubdomain(functs);
+        timings.assembly = elapsed(assemblyTimer);
+
+        InitialGuessStats guessStats {};
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            if (withGuess)
+            {
+                guessStats = runTime_.initialGuesses[psi_.name].apply(
+                    guessControls,
+                    ls_,
+                    runTime_.t,
+                    psi_.internalVector()
+                );
+                correctBoundaryConditions(psi_, runTime_.mesh);
+                assembleSubdomain(functs);
+            }
+        }
+
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            // the coupling iterations only change the processor face contributions to the right
+            // hand side, hence the matrix is converted once
+            if (mixedPrecision) updateSinglePrecisionMatrix();
+        }
+
+        ScopedTimer timer("linearSolve");
+        Timer solveTimer;
+        NeoN::la::SolverStats stats {};
+        stats.initResNorm = globalResidualNorm();
+        stats.finalResNorm = stats.initResNorm;
+        const auto tol = std::max(criteria.absTol, criteria.relTol * stats.initResNorm);
+        NeoN::localIdx numIter = 0;
+        nCouplingIter = 0;
+        while (stats.finalResNorm > tol && nCouplingIter < controls.maxIter)
+        {
+            numIter += solveSubdomain(subdomainDict, batched, mixedPrecision).numIter;
+            correctBoundaryConditions(psi_, runTime_.mesh);
+            assembleSubdomain(functs);
+            stats.finalResNorm = globalResidualNorm();
+            nCouplingIter++;
+        }
+        stats.numIter = globalMax(numIter);
+        timings.solve = elapsed(solveTimer);
+        if (stats.finalResNorm > tol)
+        {
+            warnUnconverged(psi_.name, nCouplingIter, stats.finalResNorm, tol);
+        }
+
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            if (withGuess)
+            {
+                runTime_.initialGuesses[psi_.name].store(
+                    guessControls,
+                    runTime_.t,
+                    psi_.internalVector()
+                );
+            }
+        }
+        return {stats, guessStats};
+    }
+
+    /* @brief assembles the subdomain system with the current processor face values */
+    void assembleSubdomain(std::vector<NeoN::dsl::PostAssemblyBase<ValueType>>& functs)
+    {
+        ScopedTimer timer("PDESolver::assemble(" + psi_.name + ")");
+        if (isotropic_)
+        {
+            assembleIsotropic();
+            return;
+        }
+        // the system is reassembled by every coupling iteration
+        NeoN::fill(ls_.matrix().values(), NeoN::zero<ValueType>());
+        NeoN::fill(ls_.rhs(), NeoN::zero<ValueType>());
+        expr_.assemble(runTime_.t, runTime_.dt, sparsityPattern_, ls_);
+        for (auto& funct : functs)
+        {
+            funct(sparsityPattern_, ls_);
+        }
+    }
+
+    /* @brief solves the assembled subdomain system */
+    NeoN::la::SolverStats solveSubdomain(
+        const NeoN::Dictionary& subdomainDict,
+        bool batched,
+        bool mixedPrecision
+    )
+    {
+        auto& x = psi_.internalVector();
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            if (batched)
+            {
+                return isotropic_ ? batchedSolve(*isoLs_, x, subdomainDict)
+                                  : batchedSolve(ls_, x, subdomainDict);
+            }
+        }
+        if constexpr (std::is_same_v<ValueType, NeoN::scalar>)
+        {
+            if (mixedPrecision)
+            {
+                return mixedPrecisionSolve(
+                    ls_,
+                    x,
+                    subdomainDict,
+                    runTime_.singlePrecisionMatrices[psi_.name]
+                );
+            }
+        }
+        return NeoN::la::Solver(psi_.exec(), removeAdapterControls(subdomainDict)).solve(ls_, x);
+    }
+
+    /* @brief converts the assembled system to the float copy of the mixed precision solver
+     * @note the copy is kept by the RunTime, since the PDESolver is usually recreated for every
+     * corrector, and only reallocated if the sparsity pattern changes
+     */
+    const SinglePrecisionMatrix& updateSinglePrecisionMatrix()
+    {
+        auto& matrix = runTime_.singlePrecisionMatrices[psi_.name];
+        matrix.update(ls_, sparsityPattern_, runTime_.mesh.compactColIdxs(sparsityPattern_));
+        return matrix;
+    }
+
+    /* @brief the residual norm of the assembled system over all ranks */
+    NeoN::scalar globalResidualNorm() const
+    {
+        NeoN::Vector<ValueType> res(psi_.exec(), psi_.internalVector().size());
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            if (isotropic_)
+            {
+                computeResidual(*isoLs_, psi_.internalVector(), res);
+                return globalNorm(res);
+            }
+        }
+        NeoN::la::computeResidual(ls_.matrix(), ls_.rhs(), psi_.internalVector(), res);
+        return globalNorm(res);
+    }
+
+    /* @brief replaces A x = b by -A x = -b */
+    template<typename FunctorValueType>
+    static void negate(NeoN::la::LinearSystem<FunctorValueType, NeoN::localIdx>& ls)
+    {
+        auto [values, rhs] = views(ls.matrix().values(), ls.rhs());
+        NeoN::parallelFor(
+            ls.exec(),
+            {0, values.size()},
+            KOKKOS_LAMBDA(const std::size_t i) { values[i] = -values[i]; }
+        );
+        NeoN::parallelFor(
+            ls.exec(),
+            {0, rhs.size()},
+            KOKKOS_LAMBDA(const std::size_t i) { rhs[i] = -rhs[i]; }
+        );
+    }
+
+    /* @brief the elapsed time for the solver telemetry
+     * @note Timer::elapsed fences the executors, hence it is only called with telemetry enabled
+     */
+    NeoN::scalar elapsed(const Timer& timer) const
+    {
+        return runTime_.telemetry ? timer.elapsed() : 0.0;
+    }
+
+    /* @brief reports the size of the assembled system to the memory report
+     * @note the PDESolver is recreated in every time step, the entry holds the last assembly
+     */
+    void trackLinearSystem() const
+    {
+        auto& report = MemoryReport::instance();
+        if (!report.enabled()) return;
+        report.track(
+            "linearSystem",
+            psi_.name,
+            memoryUsage(ls_) + (isoLs_ ? memoryUsage(*isoLs_) : 0)
+        );
+    }
+
+    /* @brief the solver name recorded by the solver telemetry */
+    static std::string
+    solverType(const NeoN::Dictionary& fieldSolverDict, bool batched, bool mixedPrecision)
+    {
+        if (batched) return "batched";
+        if (mixedPrecision) return "mixedPrecision";
+        if (fieldSolverDict.contains("type"))
+        {
+            return fieldSolverDict.get<std::string>("type");
+        }
+        return "unknown";
+    }
+
+    /* @brief reads the `isotropic` switch of the field
+     *
+     * @details the isotropic system is only understood by the batched solver, hence
+     * `isotropic yes;` implies `batched yes;` and the field is solved by a Jacobi preconditioned
+     * BiCGStab. The solve log line of the field reports it as isotropic and batched.
+     */
+    static bool readIsotropic(const RunTime& runTime, const std::string& fieldName)
+    {
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            if (!runTime.fvSolutionDict.contains("solvers")) return false;
+            const auto& solverDict = runTime.fvSolutionDict.get<NeoN::Dictionary>("solvers");
+            if (!solverDict.contains(fieldName)) return false;
+            const auto& fieldSolverDict = solverDict.get<NeoN::Dictionary>(fieldName);
+            return readSwitch(fieldSolverDict, "isotropic", false);
+        }
+        return false;
+    }
+
+    /* @brief assembles into the Vec3 system and compresses it into the isotropic system
+     *
+     * @details the Vec3 coefficients and rhs are only allocated during assembly and released
+     * afterwards, the isotropic system keeps one scalar per non-zero
+     */
+    void assembleIsotropic()
+    {
+        if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+        {
+            auto& values = ls_.matrix().values();
+            auto& rhs = ls_.rhs();
+            if (isoLs_)
+            {
+                values.resize(isoLs_->values().size());
+                rhs.resize(isoLs_->nRows());
+                NeoN::fill(values, NeoN::zero<NeoN::Vec3>());
+                NeoN::fill(rhs, NeoN::zero<NeoN::Vec3>());
+            }
+            expr_.assemble(runTime_.t, runTime_.dt, sparsityPattern_, ls_);
+            if (isoLs_)
+            {
+                isoLs_->update(ls_);
+            }
+            else if constexpr (std::is_same_v<IndexType, NeoN::localIdx>)
+            {
+                isoLs_.emplace(ls_, runTime_.mesh.compactColIdxs(sparsityPattern_));
+            }
+            else
+            {
+                isoLs_.emplace(ls_);
+            }
+            values.resize(0);
+            rhs.resize(0);
+        }
+    }
+
     VolumeField& psi_;
     dsl::Expression<ValueType> expr_;
     const RunTime& runTime_;
     const NeoN::la::SparsityPattern& sparsityPattern_;
     NeoN::la::LinearSystem<ValueType, IndexType> ls_;
 
-    bool needReference_;
+    bool needReference_ = false;
+    // whether the assembled system is negated for the incomplete Cholesky preconditioner
+    bool negated_ = false;
     NeoN::localIdx pRefCell_;
     NeoN::scalar pRefValue_;
+
+    bool isotropic_;
+    std::optional<IsotropicLinearSystem<IndexType>> isoLs_;
 };
 
 template<typename ValueType, typename IndexType = NeoN::localIdx>
@@ -220,12 +824,38 @@ NeoN::finiteVolume::cellCentred::VolumeField<ValueType> applyOperator(
 }
 
 
+template<typename IndexType = NeoN::localIdx>
+NeoN::finiteVolume::cellCentred::VolumeField<NeoN::Vec3> applyOperator(
+    const IsotropicLinearSystem<IndexType>& ls,
+    const NeoN::finiteVolume::cellCentred::VolumeField<NeoN::Vec3>& psi
+)
+{
+    NeoN::finiteVolume::cellCentred::VolumeField<NeoN::Vec3> res(
+        psi.exec(),
+        "ls_" + psi.name,
+        psi.mesh(),
+        psi.internalVector(),
+        psi.boundaryData(),
+        psi.boundaryConditions()
+    );
+    computeResidual(ls, psi.internalVector(), res.internalVector());
+    return res;
+}
+
+
 template<typename ValueType, typename IndexType = NeoN::localIdx>
 NeoN::finiteVolume::cellCentred::VolumeField<ValueType> operator&(
     const PDESolver<ValueType, IndexType> expr,
     const NeoN::finiteVolume::cellCentred::VolumeField<ValueType>& psi
 )
 {
+    if constexpr (std::is_same_v<ValueType, NeoN::Vec3>)
+    {
+        if (expr.isotropic())
+        {
+            return applyOperator(expr.isotropicSystem(), psi);
+        }
+    }
     return applyOperator(expr.linearSystem(), psi);
 }
 
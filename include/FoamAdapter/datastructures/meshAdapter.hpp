@@ -6,12 +6,16 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "NeoN/NeoN.hpp"
 
 #include "fvMesh.H"
 
 #include "FoamAdapter/auxiliary/readers.hpp"
+#include "FoamAdapter/datastructures/connectivity.hpp"
+#include "FoamAdapter/datastructures/processorInterfaces.hpp"
+#include "FoamAdapter/datastructures/soaField.hpp"
 
 namespace FoamAdapter
 {
@@ -25,6 +29,11 @@ FieldT flatBCField(const Foam::fvMesh& mesh, std::function<FieldT(const Foam::fv
 
 NeoN::UnstructuredMesh readOpenFOAMMesh(const NeoN::Executor exec, const Foam::fvMesh& mesh);
 
+/* @brief the owner, neighbour and boundary face cells of the mesh as connectivityIdx
+ * @note fails if the cells or faces of the mesh exceed the range of connectivityIdx
+ */
+Connectivity readConnectivity(const NeoN::Executor exec, const Foam::fvMesh& mesh);
+
 /** @class MeshAdapter
  */
 class MeshAdapter : public Foam::fvMesh
@@ -33,6 +42,22 @@ class MeshAdapter : public Foam::fvMesh
 
     NeoN::UnstructuredMesh nfMesh_;
 
+    ProcessorInterfaces processorInterfaces_;
+
+    bool singlePrecisionGeometry_ =
+        time().controlDict().getOrDefault("singlePrecisionGeometry", false);
+
+    mutable std::optional<SoAFaceGeometry> soaFaceGeometry_ {};
+
+    mutable std::optional<SinglePrecisionFaceGeometry> singlePrecisionFaceGeometry_ {};
+
+    mutable std::optional<Connectivity> connectivity_ {};
+
+    mutable std::shared_ptr<const NeoN::Vector<connectivityIdx>> compactColIdxs_ {};
+
+    // the column indices compactColIdxs_ is narrowed from
+    mutable const NeoN::Vector<NeoN::localIdx>* compactColIdxsSource_ = nullptr;
+
     // Private Member Functions
 
     //- No copy construct
@@ -86,8 +111,70 @@ public:
     const NeoN::UnstructuredMesh& nfMesh() const { return nfMesh_; }
 
     const NeoN::Executor exec() const { return nfMesh().exec(); }
+
+    /* @brief the processor patches of a decomposed mesh, empty for serial runs */
+    const ProcessorInterfaces& processorInterfaces() const { return processorInterfaces_; }
+
+    /* @brief the internal face areas and weights in structure of arrays layout
+     * @note created on first use
+     */
+    const SoAFaceGeometry& soaFaceGeometry() const;
+
+    /* @brief whether the structure of arrays kernels read the single precision face geometry
+     * @details set by `singlePrecisionGeometry yes;` in the controlDict, disabled by default. Only
+     * the structure of arrays kernels, ie. `soaVectors yes;` of neoIcoFoam, read the single
+     * precision geometry. The double geometry of the meshes is kept, see
+     * SinglePrecisionFaceGeometry.
+     */
+    bool singlePrecisionGeometry() const { return singlePrecisionGeometry_; }
+
+    /* @brief switches the geometry mode and releases the cached geometry of the other mode */
+    void setSinglePrecisionGeometry(bool singlePrecision);
+
+    /* @brief the internal face areas and weights in single precision
+     * @note created on first use, in addition to the double geometry of the meshes
+     */
+    const SinglePrecisionFaceGeometry& singlePrecisionFaceGeometry() const;
+
+    /* @brief the face connectivity read by the face loops of the adapter kernels
+     * @note created on first use
+     */
+    const Connectivity& connectivity() const;
+
+    /* @brief the column indices of the sparsity pattern as connectivityIdx
+     *
+     * @details narrowed once and shared by the isotropic and mixed precision systems of all
+     * solves with this pattern, hence the conversion runs once per mesh instead of once per time
+     * step. The sparsity pattern is kept by the mesh database and outlives the systems.
+     * @note rebuilt if asked for the indices of another pattern. Without
+     * FOAMADAPTER_COMPACT_INDEX the indices of the pattern are returned without a copy.
+     */
+    std::shared_ptr<const NeoN::Vector<connectivityIdx>>
+    compactColIdxs(const NeoN::la::SparsityPattern& pattern) const;
 };
 
+/* @brief updates the processor faces of the field with the values of the neighbour ranks
+ * @note a no-op for serial runs
+ */
+template<typename ValueType>
+void exchangeHalo(fvcc::VolumeField<ValueType>& field, const MeshAdapter& mesh)
+{
+    if (mesh.processorInterfaces().empty()) return;
+    HaloExchange<ValueType>(mesh.nfMesh(), mesh.processorInterfaces()).exchange(field);
+}
+
+/* @brief corrects the physical boundary conditions while the processor faces are exchanged
+ * @note equivalent to field.correctBoundaryConditions() for serial runs
+ */
+template<typename ValueType>
+void correctBoundaryConditions(fvcc::VolumeField<ValueType>& field, const MeshAdapter& mesh)
+{
+    HaloExchange<ValueType> halo(mesh.nfMesh(), mesh.processorInterfaces());
+    halo.start(field.internalVector());
+    field.correctBoundaryConditions();
+    halo.finish(field);
+}
+
 std::unique_ptr<MeshAdapter> createMesh(const NeoN::Executor& exec, const Foam::Time& runTime);
 
 std::unique_ptr<Foam::fvMesh> createMesh(const Foam::Time& runTime);
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <mpi.h>
+
+#include "NeoN/NeoN.hpp"
+
+#include "fvMesh.H"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace FoamAdapter
+{
+
+/* @brief a processor patch of a decomposed mesh
+ *
+ * @details the faces of the patch are stored in the flattened boundary arrays of the
+ * NeoN::BoundaryMesh starting at start. The cells adjacent to these faces send their values to
+ * the neighbour rank, which receives them into the faces of its matching processor patch. Both
+ * sides order the faces identically, hence the face order is the send and receive order.
+ * The values of all interfaces are concatenated in the exchange buffers starting at offset.
+ */
+struct ProcessorInterface
+{
+    NeoN::label patchi;
+    int neighbourRank;
+    int tag;
+    NeoN::localIdx start;
+    NeoN::localIdx size;
+    NeoN::localIdx offset;
+};
+
+/*@brief the processor patches of a decomposed mesh
+ *
+ * @details OpenFOAM represents the boundaries between subdomains as processorFvPatch, which
+ * the NeoN::BoundaryMesh stores like any other patch. This class classifies them and holds the
+ * per neighbour send index lists, ie. the local cells adjacent to the processor faces, in the
+ * order of the faces. For serial runs it is empty.
+ */
+class ProcessorInterfaces
+{
+public:
+
+    ProcessorInterfaces(const NeoN::Executor& exec, const Foam::fvMesh& mesh);
+
+    /* @brief the interfaces of an undecomposed mesh, ie. none */
+    explicit ProcessorInterfaces(const NeoN::Executor& exec)
+        : sendCells_(exec, 0), receiveFaces_(exec, 0)
+    {}
+
+    bool empty() const { return interfaces_.empty(); }
+
+    const std::vector<ProcessorInterface>& interfaces() const { return interfaces_; }
+
+    bool isProcessorPatch(NeoN::label patchi) const;
+
+    /* @brief number of processor faces of all interfaces */
+    NeoN::localIdx nFaces() const { return sendCells_.size(); }
+
+    /* @brief local cells sending their value, concatenated over all interfaces */
+    const NeoN::Vector<NeoN::localIdx>& sendCells() const { return sendCells_; }
+
+    /* @brief the position of each processor face in the flattened boundary arrays */
+    const NeoN::Vector<NeoN::localIdx>& receiveFaces() const { return receiveFaces_; }
+
+private:
+
+    std::vector<ProcessorInterface> interfaces_;
+
+    NeoN::Vector<NeoN::localIdx> sendCells_;
+
+    NeoN::Vector<NeoN::localIdx> receiveFaces_;
+};
+
+/*@brief non-blocking exchange of the cell values adjacent to processor patches
+ *
+ * @details start() packs the values of the send cells and posts the receives and sends, wait()
+ * blocks until they completed and returns the neighbour cell value of each processor face. Kernels
+ * overlap the communication by computing the internal and physical boundary faces in between and
+ * finishing the processor faces afterwards.
+ * finish() waits and sets the boundary data of the processor faces:
+ * - refValue to the neighbour cell value and valueFraction to one, hence operators treat the
+ *   face like a fixed value at the distance of the neighbour cell centre
+ * - value to the linear interpolate of the owner and neighbour cell value
+ * Implicit operators thus couple the subdomains through the lagged neighbour values. The
+ * PDESolver iterates subdomain solves and exchanges until the residual over all ranks converges,
+ * see PDESolver::solveCoupled.
+ * @note the buffers are staged through the host, device aware MPI is not required
+ * @note concurrent exchanges between the same ranks are matched in the order they are started
+ */
+template<typename ValueType>
+class HaloExchange
+{
+public:
+
+    HaloExchange(const NeoN::UnstructuredMesh& nfMesh, const ProcessorInterfaces& interfaces)
+        : nfMesh_(nfMesh), interfaces_(interfaces)
+        , sendBuffer_(interfaces.nFaces()), recvBuffer_(interfaces.nFaces())
+        , received_(nfMesh.exec(), interfaces.nFaces())
+    {}
+
+    ~HaloExchange()
+    {
+        // MPI is not initialized in serial runs
+        if (requests_.empty()) return;
+        MPI_Waitall(requests_.size(), requests_.data(), MPI_STATUSES_IGNORE);
+    }
+
+    HaloExchange(const HaloExchange&) = delete;
+
+    HaloExchange& operator=(const HaloExchange&) = delete;
+
+    /* @brief posts the exchange of the cell values, returns without waiting */
+    void start(const NeoN::Vector<ValueType>& cellValues)
+    {
+        if (interfaces_.empty()) return;
+
+        const auto exec = cellValues.exec();
+        NeoN::Vector<ValueType> packed(exec, interfaces_.nFaces());
+        auto packedView = packed.view();
+        const auto [values, sendCells] = views(cellValues, interfaces_.sendCells());
+        NeoN::parallelFor(
+            exec,
+            {0, packed.size()},
+            KOKKOS_LAMBDA(const size_t i) { packedView[i] = values[sendCells[i]]; }
+        );
+        auto packedHost = packed.copyToHost();
+        auto packedHostView = packedHost.view();
+        std::copy(packedHostView.begin(), packedHostView.end(), sendBuffer_.begin());
+
+        requests_.resize(2 * interfaces_.interfaces().size());
+        std::size_t r = 0;
+        for (const auto& interface : interfaces_.interfaces())
+        {
+            const auto offset = interface.offset;
+            const int nBytes = interface.size * sizeof(ValueType);
+            MPI_Irecv(
+                recvBuffer_.data() + offset,
+                nBytes,
+                MPI_BYTE,
+                interface.neighbourRank,
+                interface.tag,
+                MPI_COMM_WORLD,
+                &requests_[r++]
+            );
+            MPI_Isend(
+                sendBuffer_.data() + offset,
+                nBytes,
+                MPI_BYTE,
+                interface.neighbourRank,
+                interface.tag,
+                MPI_COMM_WORLD,
+                &requests_[r++]
+            );
+        }
+    }
+
+    /* @brief waits for the exchange
+     * @return the neighbour cell values in the order of ProcessorInterfaces::receiveFaces
+     */
+    const NeoN::Vector<ValueType>& wait()
+    {
+        if (interfaces_.empty()) return received_;
+
+        MPI_Waitall(requests_.size(), requests_.data(), MPI_STATUSES_IGNORE);
+        requests_.clear();
+        received_ =
+            NeoN::Vector<ValueType>(received_.exec(), recvBuffer_.data(), recvBuffer_.size());
+        return received_;
+    }
+
+    /* @brief waits for the exchange and sets the boundary data of the processor faces */
+    void finish(fvcc::VolumeField<ValueType>& field)
+    {
+        if (interfaces_.empty()) return;
+
+        const auto& received = wait();
+        const auto& bMesh = nfMesh_.boundaryMesh();
+        auto& bData = field.boundaryData();
+        auto [value, refValue, valueFraction, refGrad] =
+            views(bData.value(), bData.refValue(), bData.valueFraction(), bData.refGrad());
+        const auto [neighbourValues, faces, faceCells, weights, internal] = views(
+            received,
+            interfaces_.receiveFaces(),
+            bMesh.faceCells(),
+            bMesh.weights(),
+            field.internalVector()
+        );
+        NeoN::parallelFor(
+            field.exec(),
+            {0, received.size()},
+            KOKKOS_LAMBDA(const size_t i) {
+                const auto facei = faces[i];
+                const auto own = internal[faceCells[facei]];
+                refValue[facei] = neighbourValues[i];
+                valueFraction[facei] = 1.0;
+                refGrad[facei] = NeoN::zero<ValueType>();
+                value[facei] = weights[facei] * own + (1.0 - weights[facei]) * neighbourValues[i];
+            }
+        );
+    }
+
+    void exchange(fvcc::VolumeField<ValueType>& field)
+    {
+        start(field.internalVector());
+        finish(field);
+    }
+
+private:
+
+    const NeoN::UnstructuredMesh& nfMesh_;
+
+    const ProcessorInterfaces& interfaces_;
+
+    std::vector<ValueType> sendBuffer_;
+
+    std::vector<ValueType> recvBuffer_;
+
+    NeoN::Vector<ValueType> received_;
+
+    std::vector<MPI_Request> requests_ {};
+};
+
+}
@@ -4,12 +4,21 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
+
 #include "NeoN/NeoN.hpp"
 
 #include "fvMesh.H"
 
 #include "FoamAdapter/datastructures/meshAdapter.hpp"
 #include "FoamAdapter/auxiliary/readers.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+#include "FoamAdapter/auxiliary/collatedWriter.hpp"
+#include "FoamAdapter/auxiliary/solverTelemetry.hpp"
+#include "FoamAdapter/linearAlgebra/initialGuess.hpp"
+#include "FoamAdapter/linearAlgebra/mixedPrecisionSolver.hpp"
 
 namespace FoamAdapter
 {
@@ -29,5 +38,16 @@ namespace FoamAdapter
         NeoN::Dictionary controlDict;
         NeoN::Dictionary fvSolutionDict;
         NeoN::Dictionary fvSchemesDict;
+        // solution histories by field name, updated by the PDESolver of the field
+        mutable std::map<std::string, InitialGuess> initialGuesses {};
+        // float copies of the mixed precision systems by field name, kept while the pattern is
+        // unchanged
+        mutable std::map<std::string, SinglePrecisionMatrix> singlePrecisionMatrices {};
+        // temporary fields of the correctors, eg. rAU and HbyA, reused by the next corrector
+        mutable VolumeFieldPool fieldPool {};
+        // per solve performance records, enabled by `solverTelemetry yes;` in the controlDict
+        std::shared_ptr<SolverTelemetry> telemetry {};
+        // collated output of decomposed runs, enabled by `collatedWrite yes;` in the controlDict
+        std::shared_ptr<CollatedWriter> collatedWriter {};
     };
 } // End namespace FoamAdapter
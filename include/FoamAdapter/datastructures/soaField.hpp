@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace FoamAdapter
+{
+
+/*@brief Vec3 values stored as one contiguous scalar vector per component
+ *
+ * @details NeoN stores Vec3 vectors as array of structures, hence a kernel reading one component
+ * loads every third scalar and a kernel updating a value needs an atomic on the 24 byte Vec3. The
+ * structure of arrays layout gives unit stride loads per component and native scalar atomics.
+ */
+class SoAVector
+{
+public:
+
+    /* @brief a vector with unspecified values */
+    SoAVector(const NeoN::Executor& exec, std::size_t size);
+
+    /* @brief splits the array of structures vector into its components */
+    explicit SoAVector(const NeoN::Vector<NeoN::Vec3>& aos);
+
+    SoAVector(
+        NeoN::Vector<NeoN::scalar> x,
+        NeoN::Vector<NeoN::scalar> y,
+        NeoN::Vector<NeoN::scalar> z
+    );
+
+    std::size_t size() const { return x_.size(); }
+
+    NeoN::Executor exec() const { return x_.exec(); }
+
+    NeoN::Vector<NeoN::scalar>& x() { return x_; }
+
+    NeoN::Vector<NeoN::scalar>& y() { return y_; }
+
+    NeoN::Vector<NeoN::scalar>& z() { return z_; }
+
+    const NeoN::Vector<NeoN::scalar>& x() const { return x_; }
+
+    const NeoN::Vector<NeoN::scalar>& y() const { return y_; }
+
+    const NeoN::Vector<NeoN::scalar>& z() const { return z_; }
+
+    void fill(const NeoN::Vec3& value);
+
+    /* @brief copies the components into the array of structures vector of the same size */
+    void copyTo(NeoN::Vector<NeoN::Vec3>& aos) const;
+
+    NeoN::Vector<NeoN::Vec3> toAoS() const;
+
+    SoAVector copyToHost() const;
+
+private:
+
+    NeoN::Vector<NeoN::scalar> x_;
+
+    NeoN::Vector<NeoN::scalar> y_;
+
+    NeoN::Vector<NeoN::scalar> z_;
+};
+
+/*@brief internal and boundary values of a vector volume field in structure of arrays layout
+ *
+ * @details the field carries no boundary conditions, the kernels producing it set the boundary
+ * values. Fields are converted from and to NeoN::VolumeField<Vec3> where they enter or leave the
+ * adapter, ie. by constructSoAFrom, write and copyTo.
+ */
+class SoAVolumeField
+{
+public:
+
+    /* @brief a field with unspecified values
+     * @note the values are drawn from the VectorPool and returned to it on destruction, hence
+     * temporaries like HbyA or the pressure gradient reuse the memory of the last corrector
+     */
+    SoAVolumeField(const NeoN::UnstructuredMesh& mesh, const std::string& name);
+
+    explicit SoAVolumeField(const fvcc::VolumeField<NeoN::Vec3>& field);
+
+    ~SoAVolumeField();
+
+    SoAVolumeField(const SoAVolumeField&) = delete;
+
+    SoAVolumeField& operator=(const SoAVolumeField&) = delete;
+
+    /* @brief copies the internal and boundary values into the field of the same mesh */
+    void copyTo(fvcc::VolumeField<NeoN::Vec3>& field) const;
+
+    const NeoN::UnstructuredMesh& mesh() const { return mesh_; }
+
+    NeoN::Executor exec() const { return internal_.exec(); }
+
+    SoAVector& internalVector() { return internal_; }
+
+    const SoAVector& internalVector() const { return internal_; }
+
+    /* @brief the values of all boundary faces, in the order of the NeoN::BoundaryMesh */
+    SoAVector& boundaryValue() { return boundary_; }
+
+    const SoAVector& boundaryValue() const { return boundary_; }
+
+    std::string name;
+
+private:
+
+    const NeoN::UnstructuredMesh& mesh_;
+
+    SoAVector internal_;
+
+    SoAVector boundary_;
+
+    // whether the values are returned to the VectorPool
+    bool pooled_ = false;
+};
+
+/* @brief the face geometry of the structure of arrays kernels
+ * @note only the internal faces are stored, boundary faces use the NeoN::BoundaryMesh
+ */
+struct SoAFaceGeometry
+{
+    SoAVector faceAreas;
+
+    // linear interpolation weight of the owner cell
+    NeoN::Vector<NeoN::scalar> weights;
+};
+
+/*@brief the internal face geometry of the structure of arrays kernels in single precision
+ *
+ * @details used instead of SoAFaceGeometry when `singlePrecisionGeometry yes;` is set in the
+ * controlDict. The face loops read 16 instead of 32 bytes of geometry per face. The values are
+ * rounded to float, the kernels compute in double precision.
+ * @note this is a precision and bandwidth experiment, not a memory optimisation: the double
+ * SoAFaceGeometry is not built, but the NeoN and OpenFOAM meshes keep their double face areas,
+ * weights and the arrays derived from them (magFaceAreas, boundary deltas), so the 16 bytes per
+ * face are added to the mesh memory
+ */
+struct SinglePrecisionFaceGeometry
+{
+    NeoN::Vector<float> sfX;
+
+    NeoN::Vector<float> sfY;
+
+    NeoN::Vector<float> sfZ;
+
+    // linear interpolation weight of the owner cell
+    NeoN::Vector<float> weights;
+};
+
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/linearAlgebra/isotropicLinearSystem.hpp"
+#include "FoamAdapter/linearAlgebra/solverCriteria.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief whether all components of every coefficient of a Vec3 system are the same
+ *
+ * @details The momentum matrix stores three identical coefficients per non-zero, except for
+ * boundary conditions acting per component, eg. symmetry or slip. The components are compared
+ * by one reduction on the executor.
+ */
+bool isotropicCoefficients(const NeoN::la::LinearSystem<NeoN::Vec3, NeoN::localIdx>& ls);
+
+/* @brief extracts the scalar coefficients of a Vec3 system
+ *
+ * @details keeps only the first component, which reduces the memory footprint of the matrix
+ * values by a factor of three.
+ * @note only valid for isotropicCoefficients
+ */
+NeoN::Vector<NeoN::scalar>
+scalarCoefficients(const NeoN::la::LinearSystem<NeoN::Vec3, NeoN::localIdx>& ls);
+
+/* @brief solves A x = b for three right hand sides sharing one scalar matrix
+ *
+ * @details Runs a single Jacobi preconditioned BiCGStab for all three components of x, so every
+ * sparse matrix vector product reads the scalar coefficients once and applies them to all three
+ * components. The Krylov coefficients are kept per component, a component drops out of the
+ * iteration once it has converged.
+ *
+ * @param values the scalar CSR coefficients
+ * @param colIdxs the CSR column indices
+ * @param rowOffs the CSR row offsets
+ * @param rhs the vector valued right hand side
+ * @param x the initial guess on entry, the solution on exit
+ * @param setupTime if given, the time of the preconditioner setup
+ * @return the solver statistics, residual norms are the maximum over all three components
+ */
+NeoN::la::SolverStats batchedSolve(
+    const NeoN::Vector<NeoN::scalar>& values,
+    const NeoN::Vector<NeoN::localIdx>& colIdxs,
+    const NeoN::Vector<NeoN::localIdx>& rowOffs,
+    const NeoN::Vector<NeoN::Vec3>& rhs,
+    NeoN::Vector<NeoN::Vec3>& x,
+    const SolverCriteria& criteria,
+    NeoN::scalar* setupTime = nullptr
+);
+
+/* @brief solves the Vec3 linear system component coupled using its scalar coefficients
+ *
+ * @details If the components of the coefficients differ, see isotropicCoefficients, the same
+ * iteration runs on the Vec3 coefficients, ie. every component is solved with its own matrix.
+ * @note the setup time includes the isotropy check and the extraction of the scalar coefficients
+ * @note only the criteria of the solver dictionary are applied, a solver or preconditioner other
+ * than BiCGStab with a diagonal preconditioner is rejected by requireSupportedSettings
+ * @return the solver statistics
+ */
+NeoN::la::SolverStats batchedSolve(
+    const NeoN::la::LinearSystem<NeoN::Vec3, NeoN::localIdx>& ls,
+    NeoN::Vector<NeoN::Vec3>& x,
+    const NeoN::Dictionary& solverDict,
+    NeoN::scalar* setupTime = nullptr
+);
+
+/* @brief solves an isotropic Vec3 linear system
+ * @note rejects unsupported settings like the solve of a Vec3 linear system
+ * @return the solver statistics
+ */
+NeoN::la::SolverStats batchedSolve(
+    const IsotropicLinearSystem<NeoN::localIdx>& ls,
+    NeoN::Vector<NeoN::Vec3>& x,
+    const NeoN::Dictionary& solverDict,
+    NeoN::scalar* setupTime = nullptr
+);
+
+}
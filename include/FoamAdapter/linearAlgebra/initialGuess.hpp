@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <deque>
+#include <string>
+#include <utility>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief strategies to construct the initial guess of an iterative solve
+ *
+ * @details
+ * - previous: start from the current solution, ie. the default behaviour
+ * - extrapolate: linear extrapolation from the solutions of the last two time steps
+ * - projection: minimizes the residual over the span of the most recent solutions
+ */
+enum class InitialGuessType
+{
+    previous,
+    extrapolate,
+    projection
+};
+
+/* @brief initial guess controls of a field
+ *
+ * @details read from the solver dictionary of the field, ie.
+ *     initialGuess        projection;
+ *     nProjectionVectors  4;
+ */
+struct InitialGuessControls
+{
+    InitialGuessType type = InitialGuessType::previous;
+    NeoN::localIdx nProjectionVectors = 4;
+
+    static InitialGuessControls read(const NeoN::Dictionary& fieldSolverDict);
+};
+
+std::string name(InitialGuessType type);
+
+/* @brief residual norms of the current solution and of the constructed initial guess */
+struct InitialGuessStats
+{
+    NeoN::scalar previousResNorm = 0.0;
+    NeoN::scalar guessResNorm = 0.0;
+
+    /* @brief ratio of the guess residual to the residual of the current solution */
+    NeoN::scalar residualRatio() const;
+
+    /* @brief estimates the number of iterations saved by the initial guess
+     *
+     * @details assumes the average convergence rate of the subsequent solve, ie. the number of
+     * iterations needed to reduce the residual from previousResNorm to guessResNorm
+     */
+    NeoN::scalar iterationsSaved(const NeoN::la::SolverStats& stats) const;
+};
+
+/*@brief solution history of a scalar field used to construct initial guesses
+ *
+ * @details Stores the final solution of the last two time steps and the most recent solutions of
+ * all solves, eg. of all pressure correctors. The history has to outlive the PDESolver, which is
+ * usually recreated in every corrector, hence it is kept by the RunTime.
+ */
+class InitialGuess
+{
+public:
+
+    /* @brief replaces x by the initial guess
+     *
+     * @details the guess is only accepted if it reduces the residual of the assembled system.
+     * On decomposed meshes the residual norms and the projection are reduced over all ranks,
+     * hence all ranks accept or reject the guess together.
+     * @param ls the assembled linear system
+     * @param t the time of the solve
+     * @param x the current solution on entry, the initial guess on exit
+     */
+    InitialGuessStats apply(
+        const InitialGuessControls& controls,
+        const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+        NeoN::scalar t,
+        NeoN::Vector<NeoN::scalar>& x
+    ) const;
+
+    /* @brief adds the solution of a solve at time t to the history */
+    void store(
+        const InitialGuessControls& controls,
+        NeoN::scalar t,
+        const NeoN::Vector<NeoN::scalar>& x
+    );
+
+private:
+
+    void extrapolate(NeoN::scalar t, NeoN::Vector<NeoN::scalar>& x) const;
+
+    void project(
+        const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+        NeoN::Vector<NeoN::scalar>& x
+    ) const;
+
+    // final solutions of the last two time steps, oldest first
+    std::deque<std::pair<NeoN::scalar, NeoN::Vector<NeoN::scalar>>> timeLevels_;
+
+    // most recent solutions spanning the projection subspace, oldest first
+    std::deque<NeoN::Vector<NeoN::scalar>> subspace_;
+};
+
+}
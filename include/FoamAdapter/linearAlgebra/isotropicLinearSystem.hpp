@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/datastructures/connectivity.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief y = A x for a scalar CSR matrix applied to all three components of x */
+template<typename IndexType = NeoN::localIdx, typename ColIdxType = IndexType>
+void isotropicSpmv(
+    const NeoN::Vector<NeoN::scalar>& values,
+    const NeoN::Vector<ColIdxType>& colIdxs,
+    const NeoN::Vector<IndexType>& rowOffs,
+    const NeoN::Vector<NeoN::Vec3>& x,
+    NeoN::Vector<NeoN::Vec3>& y
+)
+{
+    const auto [valuesView, colView, rowView, xView] = views(values, colIdxs, rowOffs, x);
+    auto yView = y.view();
+    NeoN::parallelFor(
+        y.exec(),
+        {0, y.size()},
+        KOKKOS_LAMBDA(const size_t rowi) {
+            NeoN::Vec3 sum(0.0, 0.0, 0.0);
+            for (auto j = rowView[rowi]; j < rowView[rowi + 1]; j++)
+            {
+                sum += valuesView[j] * xView[colView[j]];
+            }
+            yView[rowi] = sum;
+        }
+    );
+}
+
+/*@brief linear system of a vector equation with isotropic coefficients
+ *
+ * @details Operators like ddt, div and laplacian with scalar coefficients produce the same
+ * coefficient for all three components of a Vec3 equation. Instead of three identical
+ * coefficients per non-zero this system stores a single scalar coefficient together with the
+ * vector valued right hand side. The column indices are stored as connectivityIdx and shared
+ * between the systems of the same sparsity pattern, the row offsets keep the IndexType of the
+ * assembled system.
+ */
+template<typename IndexType = NeoN::localIdx>
+class IsotropicLinearSystem
+{
+public:
+
+    /*@brief compresses an assembled Vec3 system, only the first component is kept */
+    explicit IsotropicLinearSystem(const NeoN::la::LinearSystem<NeoN::Vec3, IndexType>& ls)
+        : IsotropicLinearSystem(
+              ls,
+              std::make_shared<const NeoN::Vector<connectivityIdx>>(
+                  narrowIndices<connectivityIdx>(ls.matrix().colIdxs())
+              )
+          )
+    {}
+
+    /*@brief compresses an assembled Vec3 system with the given narrowed column indices
+     * @note the column indices are shared, eg. with the ones cached by MeshAdapter::compactColIdxs
+     */
+    IsotropicLinearSystem(
+        const NeoN::la::LinearSystem<NeoN::Vec3, IndexType>& ls,
+        std::shared_ptr<const NeoN::Vector<connectivityIdx>> colIdxs
+    )
+        : values_(ls.exec(), ls.matrix().values().size())
+        , colIdxs_(std::move(colIdxs))
+        , rowOffs_(ls.matrix().rowOffs())
+        , rhs_(ls.rhs())
+    {
+        NF_ASSERT_EQUAL(colIdxs_->size(), ls.matrix().colIdxs().size());
+        update(ls);
+    }
+
+    /*@brief updates coefficients and rhs from a Vec3 system with the same sparsity pattern */
+    void update(const NeoN::la::LinearSystem<NeoN::Vec3, IndexType>& ls)
+    {
+        NF_ASSERT_EQUAL(values_.size(), ls.matrix().values().size());
+        const auto vec3Values = ls.matrix().values().view();
+        // all the components of a coefficient are the same
+        values_.apply(KOKKOS_LAMBDA(const size_t i) { return vec3Values[i][0]; });
+        rhs_ = ls.rhs();
+    }
+
+    [[nodiscard]] const NeoN::Vector<NeoN::scalar>& values() const { return values_; }
+
+    [[nodiscard]] NeoN::Vector<NeoN::scalar>& values() { return values_; }
+
+    [[nodiscard]] const NeoN::Vector<connectivityIdx>& colIdxs() const { return *colIdxs_; }
+
+    [[nodiscard]] const NeoN::Vector<IndexType>& rowOffs() const { return rowOffs_; }
+
+    [[nodiscard]] const NeoN::Vector<NeoN::Vec3>& rhs() const { return rhs_; }
+
+    [[nodiscard]] NeoN::Vector<NeoN::Vec3>& rhs() { return rhs_; }
+
+    [[nodiscard]] NeoN::localIdx nRows() const { return rhs_.size(); }
+
+    [[nodiscard]] const NeoN::Executor& exec() const { return values_.exec(); }
+
+private:
+
+    NeoN::Vector<NeoN::scalar> values_;
+    std::shared_ptr<const NeoN::Vector<connectivityIdx>> colIdxs_;
+    NeoN::Vector<IndexType> rowOffs_;
+    NeoN::Vector<NeoN::Vec3> rhs_;
+};
+
+/*@brief extracts the scalar diagonal of an isotropic system */
+template<typename IndexType = NeoN::localIdx>
+NeoN::Vector<NeoN::scalar> diag(
+    const IsotropicLinearSystem<IndexType>& ls,
+    const NeoN::la::SparsityPattern& sparsityPattern
+)
+{
+    NeoN::Vector<NeoN::scalar> diagonal(ls.exec(), sparsityPattern.diagOffset().size(), 0.0);
+    const auto [diagOffset, values, rowOffs] =
+        views(sparsityPattern.diagOffset(), ls.values(), ls.rowOffs());
+    diagonal.apply(KOKKOS_LAMBDA(const size_t celli) {
+        return values[rowOffs[celli] + diagOffset[celli]];
+    });
+    return diagonal;
+}
+
+/*@brief computes res = b - A x */
+template<typename IndexType = NeoN::localIdx>
+void computeResidual(
+    const IsotropicLinearSystem<IndexType>& ls,
+    const NeoN::Vector<NeoN::Vec3>& x,
+    NeoN::Vector<NeoN::Vec3>& res
+)
+{
+    isotropicSpmv(ls.values(), ls.colIdxs(), ls.rowOffs(), x, res);
+    const auto rhs = ls.rhs().view();
+    auto resView = res.view();
+    res.apply(KOKKOS_LAMBDA(const size_t i) { return rhs[i] - resView[i]; });
+}
+
+}
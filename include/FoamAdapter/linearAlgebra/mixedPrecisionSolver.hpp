@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/datastructures/connectivity.hpp"
+#include "FoamAdapter/linearAlgebra/solverCriteria.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief controls of the mixed precision solver
+ *
+ * @details read from the solver dictionary of the field, ie.
+ *     mixedPrecision  yes;
+ *     innerRelTol     0.01;
+ *     maxInnerIter    200;
+ */
+struct MixedPrecisionControls
+{
+    // residual reduction of a single precision correction solve
+    NeoN::scalar innerRelTol = 1e-2;
+    NeoN::localIdx maxInnerIter = 200;
+
+    static MixedPrecisionControls read(const NeoN::Dictionary& fieldSolverDict);
+};
+
+/* @brief the float copy of a matrix and its inverse diagonal read by the inner iterations
+ *
+ * @details The vectors are allocated and the column indices narrowed once per sparsity pattern,
+ * later updates with the same pattern only convert the values of the newly assembled matrix.
+ * The diagonal is read through the diagonal offsets of the pattern.
+ * @note the pattern has to outlive the copy, eg. the one of SparsityPattern::readOrCreate
+ */
+class SinglePrecisionMatrix
+{
+public:
+
+    /* @brief converts the matrix of ls, assembled with the given pattern
+     * @param colIdxs if given, the column indices of the pattern as connectivityIdx, eg. the ones
+     * cached by MeshAdapter::compactColIdxs, otherwise they are narrowed here
+     */
+    void update(
+        const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+        const NeoN::la::SparsityPattern& pattern,
+        std::shared_ptr<const NeoN::Vector<connectivityIdx>> colIdxs = nullptr
+    );
+
+    const NeoN::Vector<float>& values() const { return *values_; }
+
+    const NeoN::Vector<connectivityIdx>& colIdxs() const { return *colIdxs_; }
+
+    const NeoN::Vector<NeoN::localIdx>& rowOffs() const { return pattern_->rowOffs(); }
+
+    const NeoN::Vector<float>& invDiag() const { return *invDiag_; }
+
+private:
+
+    const NeoN::la::SparsityPattern* pattern_ = nullptr;
+
+    std::optional<NeoN::Vector<float>> values_ {};
+
+    std::shared_ptr<const NeoN::Vector<connectivityIdx>> colIdxs_ {};
+
+    std::optional<NeoN::Vector<float>> invDiag_ {};
+};
+
+/* @brief solves A x = b by iterative refinement with single precision corrections
+ *
+ * @details The outer loop computes the residual r = b - A x of the double precision system and
+ * solves A d = r approximately by a Jacobi preconditioned BiCGStab on the float copy of the
+ * matrix and its inverse diagonal. The correction is added to x in double precision, hence the
+ * attainable accuracy is the one of the double precision system, while the inner sparse matrix
+ * vector products read only half of the bytes.
+ *
+ * @param ls the assembled double precision system
+ * @param x the initial guess on entry, the solution on exit
+ * @param matrix the float copy of the matrix of ls, see SinglePrecisionMatrix::update
+ * @return the solver statistics, numIter is the total number of inner iterations and the
+ * residual norms are the ones of the double precision system
+ */
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+    NeoN::Vector<NeoN::scalar>& x,
+    const SolverCriteria& criteria,
+    const MixedPrecisionControls& controls,
+    const SinglePrecisionMatrix& matrix
+);
+
+/* @brief solves A x = b with a float copy of the matrix created for this solve */
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+    const NeoN::la::SparsityPattern& pattern,
+    NeoN::Vector<NeoN::scalar>& x,
+    const SolverCriteria& criteria,
+    const MixedPrecisionControls& controls
+);
+
+/* @brief solves the linear system with the criteria and controls of the solver dictionary
+ * @note the inner iterations only implement a Jacobi preconditioned BiCGStab, other solvers and
+ * preconditioners are rejected by requireSupportedSettings
+ * @return the solver statistics
+ */
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& ls,
+    NeoN::Vector<NeoN::scalar>& x,
+    const NeoN::Dictionary& solverDict,
+    const SinglePrecisionMatrix& matrix
+);
+
+}
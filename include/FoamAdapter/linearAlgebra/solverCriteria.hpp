@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief stopping criteria of the solvers implemented by FoamAdapter
+ *
+ * @details the criteria are read from the same `criteria` sub dictionary that
+ * mapFvSolution generates for the Ginkgo solvers, ie. `iteration`,
+ * `relative_residual_norm` and `absolute_residual_norm`, or from the OpenFOAM `maxIter`,
+ * `relTol` and `tolerance` of an unmapped dictionary. The relative norm is taken with
+ * respect to the initial residual.
+ */
+struct SolverCriteria
+{
+    NeoN::localIdx maxIter = 1000;
+    NeoN::scalar absTol = 0.0;
+    NeoN::scalar relTol = 0.0;
+
+    static SolverCriteria read(const NeoN::Dictionary& solverDict);
+};
+
+/* @brief rejects solver settings that a FoamAdapter solver does not apply
+ *
+ * @details the batched solver and the inner iterations of the mixed precision solver run a
+ * Jacobi preconditioned BiCGStab. Accepts an unset solver and preconditioner, BiCGStab and a
+ * diagonal preconditioner, any other solver or preconditioner, eg. GAMG or DILU, or a configFile
+ * is rejected. Both the OpenFOAM and the mapped Ginkgo names are recognized.
+ * @throws std::runtime_error naming the unsupported settings
+ * @param solver the name of the calling solver used in the error
+ */
+void requireSupportedSettings(const NeoN::Dictionary& solverDict, const std::string& solver);
+
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#pragma once
+
+#include <string>
+
+#include "NeoN/NeoN.hpp"
+
+namespace FoamAdapter
+{
+
+/* @brief controls of the subdomain coupling of decomposed runs
+ *
+ * @details read from the solver dictionary of the field, ie.
+ *     maxCouplingIter 100;
+ * limits the number of subdomain solves per linear solve
+ */
+struct CouplingControls
+{
+    NeoN::localIdx maxIter = 100;
+
+    static CouplingControls read(const NeoN::Dictionary& fieldSolverDict);
+};
+
+/* @brief the L2 norm of a vector distributed over all ranks
+ * @note equivalent to the local norm for serial runs
+ */
+NeoN::scalar globalNorm(const NeoN::Vector<NeoN::scalar>& a);
+
+/* @brief the largest component L2 norm of a vector distributed over all ranks */
+NeoN::scalar globalNorm(const NeoN::Vector<NeoN::Vec3>& a);
+
+/* @brief the maximum of a value over all ranks */
+NeoN::localIdx globalMax(NeoN::localIdx value);
+
+/* @brief reports a coupling iteration that stopped at maxCouplingIter above the tolerance
+ * @note printed by the master rank only, the residual norms are the ones over all ranks
+ */
+void warnUnconverged(
+    const std::string& fieldName,
+    NeoN::localIdx nCouplingIter,
+    NeoN::scalar finalResNorm,
+    NeoN::scalar tol
+);
+
+/* @brief the solver dictionary of the subdomain solves of a decomposed run
+ *
+ * @details the absolute tolerance applies to the global residual, the subdomain solves thus reach
+ * absolute_residual_norm / sqrt(nRanks), so the sum of the squared subdomain residuals does not
+ * exceed the tolerance
+ */
+NeoN::Dictionary subdomainSolverDict(const NeoN::Dictionary& fieldSolverDict);
+
+}
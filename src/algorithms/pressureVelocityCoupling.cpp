@@ -4,6 +4,8 @@
 #include "NeoN/NeoN.hpp"
 
 #include "FoamAdapter/algorithms/pressureVelocityCoupling.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
 #include "Kokkos_Core.hpp"
 
 namespace la = NeoN::la;
@@ -17,6 +19,7 @@ void constrainHbyA(
     nnfvcc::VolumeField<Vec3>& hByA
 )
 {
+    ScopedTimer timer("constrainHbyA");
     auto hByAin = hByA.internalVector().view();
     auto [hByABcValue, uBcValue] = views(hByA.boundaryData().value(), u.boundaryData().value());
     const auto& uBCs = u.boundaryConditions();
@@ -35,64 +38,115 @@ void constrainHbyA(
     }
 }
 
-nnfvcc::VolumeField<scalar> computeRAU(const PDESolver<Vec3>& expr)
+void constrainHbyA(
+    const nnfvcc::VolumeField<Vec3>& u,
+    const nnfvcc::VolumeField<scalar>& p,
+    SoAVolumeField& hByA
+)
+{
+    ScopedTimer timer("constrainHbyA");
+    auto& hByABc = hByA.boundaryValue();
+    auto [hByABcX, hByABcY, hByABcZ] = views(hByABc.x(), hByABc.y(), hByABc.z());
+    const auto uBcValue = u.boundaryData().value().view();
+    const auto& uBCs = u.boundaryConditions();
+
+    for (auto patchi = 0; patchi < uBCs.size(); ++patchi)
+    {
+        bool assignable = uBCs[patchi].attributes().assignable;
+        if (!assignable)
+        {
+            parallelFor(
+                u.exec(),
+                u.boundaryData().range(patchi),
+                KOKKOS_LAMBDA(const size_t bfacei) {
+                    hByABcX[bfacei] = uBcValue[bfacei][0];
+                    hByABcY[bfacei] = uBcValue[bfacei][1];
+                    hByABcZ[bfacei] = uBcValue[bfacei][2];
+                }
+            );
+        }
+    }
+}
+
+namespace detail
+{
+
+/* @brief the coefficient of the Vec3 equation, all components are the same */
+KOKKOS_INLINE_FUNCTION scalar coeff(const Vec3& value) { return value[0]; }
+
+KOKKOS_INLINE_FUNCTION scalar coeff(const scalar value) { return value; }
+
+template<typename CoeffType>
+PooledVolumeField<scalar> computeRAU(
+    const PDESolver<Vec3>& expr,
+    const NeoN::Vector<CoeffType>& coeffs,
+    const NeoN::Vector<NeoN::localIdx>& rowOffs
+)
 {
-    // TODO this assumes an assembled matrix
-    // force assembly if not assembled
     const auto& mesh = expr.getField().mesh();
     const auto& sparsityPattern = expr.sparsityPattern();
-    const auto& ls = expr.linearSystem();
 
-    const auto [vol, values, diagOffset, rowPtrs] = views(
-        mesh.cellVolumes(),
-        ls.matrix().values(),
-        sparsityPattern.diagOffset(),
-        ls.matrix().rowOffs()
-    );
+    const auto [vol, values, diagOffset, rowPtrs] =
+        views(mesh.cellVolumes(), coeffs, sparsityPattern.diagOffset(), rowOffs);
 
-    auto rABCs = nnfvcc::createExtrapolatedBCs<nnfvcc::VolumeBoundary<scalar>>(mesh);
-    auto rAU = nnfvcc::VolumeField<scalar>(expr.exec(), "rAU", mesh, rABCs);
+    PooledVolumeField<scalar> rAU(
+        expr.runTime().fieldPool,
+        expr.exec(),
+        "rAU",
+        mesh,
+        [&mesh]() { return nnfvcc::createExtrapolatedBCs<nnfvcc::VolumeBoundary<scalar>>(mesh); }
+    );
 
-    rAU.internalVector().apply(KOKKOS_LAMBDA(const size_t celli) {
+    rAU->internalVector().apply(KOKKOS_LAMBDA(const size_t celli) {
         auto diagOffsetCelli = diagOffset[celli];
-        // all the diagonal coefficients are the same
-        return vol[celli] / (values[rowPtrs[celli] + diagOffsetCelli][0]);
+        return vol[celli] / coeff(values[rowPtrs[celli] + diagOffsetCelli]);
     });
 
     return rAU;
 }
 
-std::tuple<nnfvcc::VolumeField<scalar>, nnfvcc::VolumeField<Vec3>>
-computeRAUandHByA(const PDESolver<Vec3>& expr)
+template<typename CoeffType>
+std::tuple<PooledVolumeField<scalar>, PooledVolumeField<Vec3>> computeRAUandHByA(
+    const PDESolver<Vec3>& expr,
+    const NeoN::Vector<CoeffType>& coeffs,
+    const NeoN::Vector<NeoN::localIdx>& rowOffs,
+    const NeoN::Vector<Vec3>& sources
+)
 {
     const auto& u = expr.getField();
     const auto& mesh = u.mesh();
     const auto& sparsityPattern = expr.sparsityPattern();
-    const auto& ls = expr.linearSystem();
 
-    const auto [vol, values, diagOffset, rowPtrs] = views(
-        mesh.cellVolumes(),
-        ls.matrix().values(),
-        sparsityPattern.diagOffset(),
-        ls.matrix().rowOffs()
+    const auto [vol, values, diagOffset, rowPtrs] =
+        views(mesh.cellVolumes(), coeffs, sparsityPattern.diagOffset(), rowOffs);
+
+    auto rAU = computeRAU(expr, coeffs, rowOffs);
+    // the halo exchange of rAU overlaps with the face loop
+    const auto& interfaces = expr.runTime().mesh.processorInterfaces();
+    HaloExchange<scalar> rAUHalo(mesh, interfaces);
+    rAUHalo.start(rAU->internalVector());
+
+    PooledVolumeField<Vec3> hByA(
+        expr.runTime().fieldPool,
+        expr.exec(),
+        "HbyA",
+        mesh,
+        [&mesh]() { return nnfvcc::createExtrapolatedBCs<nnfvcc::VolumeBoundary<Vec3>>(mesh); }
     );
-
-    auto rAU = computeRAU(expr);
-    auto offDiagonalSourceBCs = nnfvcc::createExtrapolatedBCs<nnfvcc::VolumeBoundary<Vec3>>(mesh);
-    auto hByA = nnfvcc::VolumeField<Vec3>(expr.exec(), "HbyA", mesh, offDiagonalSourceBCs);
-    NeoN::fill(hByA.internalVector(), NeoN::zero<Vec3>());
+    NeoN::fill(hByA->internalVector(), NeoN::zero<Vec3>());
     const auto nInternalFaces = mesh.nInternalFaces();
     const auto exec = u.exec();
 
+    const auto& conn = expr.runTime().mesh.connectivity();
     const auto [owner, neighbour, ownOffs, neiOffs, internalU] = views(
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
+        conn.faceOwner,
+        conn.faceNeighbour,
         sparsityPattern.ownerOffset(),
         sparsityPattern.neighbourOffset(),
         u.internalVector()
     );
 
-    auto internalHbyA = hByA.internalVector().view();
+    auto internalHbyA = hByA->internalVector().view();
     NeoN::parallelFor(
         exec,
         {0, nInternalFaces},
@@ -103,15 +157,15 @@ computeRAUandHByA(const PDESolver<Vec3>& expr)
             auto rowNeiStart = rowPtrs[nei];
             auto rowOwnStart = rowPtrs[own];
 
-            auto lower = values[rowNeiStart + neiOffs[facei]];
-            auto upper = values[rowOwnStart + ownOffs[facei]];
+            auto lower = coeff(values[rowNeiStart + neiOffs[facei]]);
+            auto upper = coeff(values[rowOwnStart + ownOffs[facei]]);
 
-            Kokkos::atomic_sub(&internalHbyA[nei], lower[0] * internalU[own]);
-            Kokkos::atomic_sub(&internalHbyA[own], upper[0] * internalU[nei]);
+            Kokkos::atomic_sub(&internalHbyA[nei], lower * internalU[own]);
+            Kokkos::atomic_sub(&internalHbyA[own], upper * internalU[nei]);
         }
     );
 
-    const auto [rhs, internalRAU] = views(ls.rhs(), rAU.internalVector());
+    const auto [rhs, internalRAU] = views(sources, rAU->internalVector());
     NeoN::parallelFor(
         exec,
         {0, internalHbyA.size()},
@@ -121,10 +175,197 @@ computeRAUandHByA(const PDESolver<Vec3>& expr)
         }
     );
 
-    hByA.correctBoundaryConditions();
-    rAU.correctBoundaryConditions();
+    HaloExchange<Vec3> hByAHalo(mesh, interfaces);
+    hByAHalo.start(hByA->internalVector());
+    hByA->correctBoundaryConditions();
+    rAU->correctBoundaryConditions();
+    rAUHalo.finish(*rAU);
+    hByAHalo.finish(*hByA);
 
-    return {rAU, hByA};
+    return {std::move(rAU), std::move(hByA)};
+}
+
+/* @brief sets the boundary values to the adjacent cell values and the processor faces to the
+ * interpolate with the neighbour cell values, the components are exchanged while the physical
+ * boundary faces are set
+ */
+void extrapolateBoundaryValues(SoAVolumeField& field, const MeshAdapter& meshAdapter)
+{
+    const auto& mesh = field.mesh();
+    const auto& bMesh = mesh.boundaryMesh();
+    const auto& interfaces = meshAdapter.processorInterfaces();
+    auto& internal = field.internalVector();
+    auto& boundary = field.boundaryValue();
+
+    HaloExchange<scalar> haloX(mesh, interfaces);
+    HaloExchange<scalar> haloY(mesh, interfaces);
+    HaloExchange<scalar> haloZ(mesh, interfaces);
+    haloX.start(internal.x());
+    haloY.start(internal.y());
+    haloZ.start(internal.z());
+
+    const auto [x, y, z, faceCells, weights] = views(
+        internal.x(),
+        internal.y(),
+        internal.z(),
+        meshAdapter.connectivity().faceCells,
+        bMesh.weights()
+    );
+    auto [bx, by, bz] = views(boundary.x(), boundary.y(), boundary.z());
+    NeoN::parallelFor(
+        field.exec(),
+        {0, boundary.size()},
+        KOKKOS_LAMBDA(const size_t bfacei) {
+            const auto celli = faceCells[bfacei];
+            bx[bfacei] = x[celli];
+            by[bfacei] = y[celli];
+            bz[bfacei] = z[celli];
+        }
+    );
+
+    if (interfaces.empty()) return;
+
+    const auto [neiX, neiY, neiZ, procFaces] =
+        views(haloX.wait(), haloY.wait(), haloZ.wait(), interfaces.receiveFaces());
+    NeoN::parallelFor(
+        field.exec(),
+        {0, procFaces.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            const auto bfacei = procFaces[i];
+            const auto celli = faceCells[bfacei];
+            const auto w = weights[bfacei];
+            bx[bfacei] = w * x[celli] + (1.0 - w) * neiX[i];
+            by[bfacei] = w * y[celli] + (1.0 - w) * neiY[i];
+            bz[bfacei] = w * z[celli] + (1.0 - w) * neiZ[i];
+        }
+    );
+}
+
+template<typename CoeffType>
+PooledVolumeField<scalar> computeRAUandHByA(
+    const PDESolver<Vec3>& expr,
+    const NeoN::Vector<CoeffType>& coeffs,
+    const NeoN::Vector<NeoN::localIdx>& rowOffs,
+    const NeoN::Vector<Vec3>& sources,
+    SoAVolumeField& hByA
+)
+{
+    const auto& u = expr.getField();
+    const auto& mesh = u.mesh();
+    const auto& sparsityPattern = expr.sparsityPattern();
+
+    const auto [vol, values, rowPtrs] = views(mesh.cellVolumes(), coeffs, rowOffs);
+
+    auto rAU = computeRAU(expr, coeffs, rowOffs);
+    const auto& interfaces = expr.runTime().mesh.processorInterfaces();
+    HaloExchange<scalar> rAUHalo(mesh, interfaces);
+    rAUHalo.start(rAU->internalVector());
+
+    auto& internalHbyA = hByA.internalVector();
+    internalHbyA.fill(NeoN::zero<Vec3>());
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto exec = u.exec();
+
+    const auto& conn = expr.runTime().mesh.connectivity();
+    const auto [owner, neighbour, ownOffs, neiOffs, internalU] = views(
+        conn.faceOwner,
+        conn.faceNeighbour,
+        sparsityPattern.ownerOffset(),
+        sparsityPattern.neighbourOffset(),
+        u.internalVector()
+    );
+
+    auto [hX, hY, hZ] = views(internalHbyA.x(), internalHbyA.y(), internalHbyA.z());
+    NeoN::parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            auto own = owner[facei];
+            auto nei = neighbour[facei];
+
+            auto lower = coeff(values[rowPtrs[nei] + neiOffs[facei]]);
+            auto upper = coeff(values[rowPtrs[own] + ownOffs[facei]]);
+            const auto uOwn = internalU[own];
+            const auto uNei = internalU[nei];
+
+            Kokkos::atomic_sub(&hX[nei], lower * uOwn[0]);
+            Kokkos::atomic_sub(&hY[nei], lower * uOwn[1]);
+            Kokkos::atomic_sub(&hZ[nei], lower * uOwn[2]);
+            Kokkos::atomic_sub(&hX[own], upper * uNei[0]);
+            Kokkos::atomic_sub(&hY[own], upper * uNei[1]);
+            Kokkos::atomic_sub(&hZ[own], upper * uNei[2]);
+        }
+    );
+
+    const auto [rhs, internalRAU] = views(sources, rAU->internalVector());
+    NeoN::parallelFor(
+        exec,
+        {0, internalHbyA.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            const auto scale = internalRAU[celli] / vol[celli];
+            hX[celli] = (hX[celli] + rhs[celli][0]) * scale;
+            hY[celli] = (hY[celli] + rhs[celli][1]) * scale;
+            hZ[celli] = (hZ[celli] + rhs[celli][2]) * scale;
+        }
+    );
+
+    extrapolateBoundaryValues(hByA, expr.runTime().mesh);
+    rAU->correctBoundaryConditions();
+    rAUHalo.finish(*rAU);
+
+    return rAU;
+}
+
+}
+
+PooledVolumeField<scalar> computeRAU(const PDESolver<Vec3>& expr)
+{
+    ScopedTimer timer("computeRAU");
+    // TODO this assumes an assembled matrix
+    // force assembly if not assembled
+    if (expr.isotropic())
+    {
+        const auto& ls = expr.isotropicSystem();
+        return detail::computeRAU(expr, ls.values(), ls.rowOffs());
+    }
+    const auto& ls = expr.linearSystem();
+    return detail::computeRAU(expr, ls.matrix().values(), ls.matrix().rowOffs());
+}
+
+std::tuple<PooledVolumeField<scalar>, PooledVolumeField<Vec3>>
+computeRAUandHByA(const PDESolver<Vec3>& expr)
+{
+    ScopedTimer timer("computeRAUandHByA");
+    if (expr.isotropic())
+    {
+        const auto& ls = expr.isotropicSystem();
+        return detail::computeRAUandHByA(expr, ls.values(), ls.rowOffs(), ls.rhs());
+    }
+    const auto& ls = expr.linearSystem();
+    return detail::computeRAUandHByA(
+        expr,
+        ls.matrix().values(),
+        ls.matrix().rowOffs(),
+        ls.rhs()
+    );
+}
+
+PooledVolumeField<scalar> computeRAUandHByA(const PDESolver<Vec3>& expr, SoAVolumeField& hByA)
+{
+    ScopedTimer timer("computeRAUandHByA");
+    if (expr.isotropic())
+    {
+        const auto& ls = expr.isotropicSystem();
+        return detail::computeRAUandHByA(expr, ls.values(), ls.rowOffs(), ls.rhs(), hByA);
+    }
+    const auto& ls = expr.linearSystem();
+    return detail::computeRAUandHByA(
+        expr,
+        ls.matrix().values(),
+        ls.matrix().rowOffs(),
+        ls.rhs(),
+        hByA
+    );
 }
 
 
@@ -134,14 +375,16 @@ void updateFaceVelocity(
     nnfvcc::SurfaceField<scalar>& phi
 )
 {
+    ScopedTimer timer("updateFaceVelocity");
     const auto& mesh = phi.mesh();
     const auto& p = expr.getField();
     const auto sparsityPattern = expr.sparsityPattern();
     const auto nInternalFaces = mesh.nInternalFaces();
     const auto exec = phi.exec();
+    const auto& conn = expr.runTime().mesh.connectivity();
     const auto [owner, neighbour, ownOffs, neiOffs, internalP] = views(
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
+        conn.faceOwner,
+        conn.faceNeighbour,
         sparsityPattern.ownerOffset(),
         sparsityPattern.neighbourOffset(),
         p.internalVector()
@@ -154,6 +397,12 @@ void updateFaceVelocity(
     auto rhs = ls.rhs().view();
     auto [iPhi, iPredPhi] = views(phi.internalVector(), predictedPhi.internalVector());
 
+    // the neighbour pressure of the processor faces is exchanged while the internal and physical
+    // boundary faces are computed
+    const auto& interfaces = expr.runTime().mesh.processorInterfaces();
+    HaloExchange<scalar> pHalo(mesh, interfaces);
+    pHalo.start(p.internalVector());
+
     NeoN::parallelFor(
         exec,
         {0, nInternalFaces},
@@ -171,11 +420,8 @@ void updateFaceVelocity(
         }
     );
 
-    auto [bvalue, bPredValue, faceCells] = views(
-        phi.boundaryData().value(),
-        predictedPhi.boundaryData().value(),
-        mesh.boundaryMesh().faceCells()
-    );
+    auto [bvalue, bPredValue, faceCells] =
+        views(phi.boundaryData().value(), predictedPhi.boundaryData().value(), conn.faceCells);
 
     auto& bcCoeffs =
         ls.auxiliaryCoefficients().get<la::BoundaryCoefficients<NeoN::scalar, NeoN::localIdx>>(
@@ -194,6 +440,22 @@ void updateFaceVelocity(
             bvalue[bfacei] = bPredValue[bfacei] - bflux;
         }
     );
+
+    if (interfaces.empty()) return;
+
+    // the assembled boundary coefficients hold the lagged neighbour pressure, the flux through
+    // processor faces uses the current one
+    const auto [pNei, procFaces] = views(pHalo.wait(), interfaces.receiveFaces());
+    NeoN::parallelFor(
+        exec,
+        {0, procFaces.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            auto bfacei = procFaces[i];
+            scalar bflux = mValue[bfacei] * (pNei[i] - internalP[faceCells[bfacei]]);
+            iPhi[nInternalFaces + bfacei] = iPredPhi[nInternalFaces + bfacei] - bflux;
+            bvalue[bfacei] = bPredValue[bfacei] - bflux;
+        }
+    );
 }
 
 void updateVelocity(
@@ -203,6 +465,7 @@ void updateVelocity(
     nnfvcc::VolumeField<Vec3>& u
 )
 {
+    ScopedTimer timer("updateVelocity");
     auto gradP = nnfvcc::GaussGreenGrad(p.exec(), p.mesh()).grad(p);
     auto [iHbyA, iRAU, iGradP] =
         views(hByA.internalVector(), rAU.internalVector(), gradP.internalVector());
@@ -212,12 +475,172 @@ void updateVelocity(
     });
 }
 
-nnfvcc::SurfaceField<scalar> flux(const nnfvcc::VolumeField<Vec3>& volField)
+void updateVelocity(
+    const SoAVolumeField& hByA,
+    const nnfvcc::VolumeField<scalar>& rAU,
+    const nnfvcc::VolumeField<scalar>& p,
+    const MeshAdapter& mesh,
+    nnfvcc::VolumeField<Vec3>& u
+)
+{
+    ScopedTimer timer("updateVelocity");
+    SoAVolumeField gradP(p.mesh(), "gradP");
+    gaussGreenGrad(p, mesh, gradP);
+    const auto& iHbyA = hByA.internalVector();
+    const auto& iGradP = gradP.internalVector();
+    const auto [hX, hY, hZ, gradX, gradY, gradZ, iRAU] = views(
+        iHbyA.x(),
+        iHbyA.y(),
+        iHbyA.z(),
+        iGradP.x(),
+        iGradP.y(),
+        iGradP.z(),
+        rAU.internalVector()
+    );
+
+    u.internalVector().apply(KOKKOS_LAMBDA(const std::size_t celli) {
+        const auto r = iRAU[celli];
+        return Vec3(
+            hX[celli] - r * gradX[celli],
+            hY[celli] - r * gradY[celli],
+            hZ[celli] - r * gradZ[celli]
+        );
+    });
+}
+
+namespace detail
+{
+
+/* @brief the Gauss Green gradient with the internal face geometry in GeomType precision */
+template<typename GeomType>
+void gaussGreenGrad(
+    const nnfvcc::VolumeField<scalar>& p,
+    const Connectivity& conn,
+    const NeoN::Vector<GeomType>& faceAreasX,
+    const NeoN::Vector<GeomType>& faceAreasY,
+    const NeoN::Vector<GeomType>& faceAreasZ,
+    const NeoN::Vector<GeomType>& faceWeights,
+    SoAVolumeField& grad
+)
+{
+    const auto exec = p.exec();
+    const auto& nfMesh = p.mesh();
+    const auto nInternalFaces = nfMesh.nInternalFaces();
+
+    auto& internal = grad.internalVector();
+    internal.fill(NeoN::zero<Vec3>());
+    auto [gradX, gradY, gradZ] = views(internal.x(), internal.y(), internal.z());
+
+    const auto [owner, neighbour, weights, sfX, sfY, sfZ, iP] = views(
+        conn.faceOwner,
+        conn.faceNeighbour,
+        faceWeights,
+        faceAreasX,
+        faceAreasY,
+        faceAreasZ,
+        p.internalVector()
+    );
+    NeoN::parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            auto own = static_cast<std::size_t>(owner[facei]);
+            auto nei = static_cast<std::size_t>(neighbour[facei]);
+            const auto w = static_cast<scalar>(weights[facei]);
+            const auto pf = w * (iP[own] - iP[nei]) + iP[nei];
+            const auto fX = static_cast<scalar>(sfX[facei]) * pf;
+            const auto fY = static_cast<scalar>(sfY[facei]) * pf;
+            const auto fZ = static_cast<scalar>(sfZ[facei]) * pf;
+
+            Kokkos::atomic_add(&gradX[own], fX);
+            Kokkos::atomic_add(&gradY[own], fY);
+            Kokkos::atomic_add(&gradZ[own], fZ);
+            Kokkos::atomic_sub(&gradX[nei], fX);
+            Kokkos::atomic_sub(&gradY[nei], fY);
+            Kokkos::atomic_sub(&gradZ[nei], fZ);
+        }
+    );
+
+    const auto [bP, bSf, faceCells] =
+        views(p.boundaryData().value(), nfMesh.boundaryMesh().sf(), conn.faceCells);
+    NeoN::parallelFor(
+        exec,
+        {0, bP.size()},
+        KOKKOS_LAMBDA(const size_t bfacei) {
+            const auto celli = faceCells[bfacei];
+            Kokkos::atomic_add(&gradX[celli], bSf[bfacei][0] * bP[bfacei]);
+            Kokkos::atomic_add(&gradY[celli], bSf[bfacei][1] * bP[bfacei]);
+            Kokkos::atomic_add(&gradZ[celli], bSf[bfacei][2] * bP[bfacei]);
+        }
+    );
+
+    const auto vol = nfMesh.cellVolumes().view();
+    NeoN::parallelFor(
+        exec,
+        {0, internal.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            gradX[celli] /= vol[celli];
+            gradY[celli] /= vol[celli];
+            gradZ[celli] /= vol[celli];
+        }
+    );
+}
+
+}
+
+void gaussGreenGrad(
+    const nnfvcc::VolumeField<scalar>& p,
+    const MeshAdapter& mesh,
+    SoAVolumeField& grad
+)
+{
+    ScopedTimer timer("gaussGreenGrad");
+    if (mesh.singlePrecisionGeometry())
+    {
+        const auto& geometry = mesh.singlePrecisionFaceGeometry();
+        detail::gaussGreenGrad(
+            p,
+            mesh.connectivity(),
+            geometry.sfX,
+            geometry.sfY,
+            geometry.sfZ,
+            geometry.weights,
+            grad
+        );
+        return;
+    }
+    const auto& geometry = mesh.soaFaceGeometry();
+    detail::gaussGreenGrad(
+        p,
+        mesh.connectivity(),
+        geometry.faceAreas.x(),
+        geometry.faceAreas.y(),
+        geometry.faceAreas.z(),
+        geometry.weights,
+        grad
+    );
+}
+
+namespace detail
+{
+
+/* @brief the flux with the face connectivity in IndexType */
+template<typename IndexType>
+nnfvcc::SurfaceField<scalar> flux(
+    const nnfvcc::VolumeField<Vec3>& volField,
+    const NeoN::Vector<IndexType>& faceOwner,
+    const NeoN::Vector<IndexType>& faceNeighbour,
+    const NeoN::Vector<IndexType>& faceCells,
+    const ProcessorInterfaces& interfaces
+)
 {
     const auto exec = volField.exec();
 
     const auto& mesh = volField.mesh();
     const auto nInternalFaces = mesh.nInternalFaces();
+    HaloExchange<Vec3> halo(mesh, interfaces);
+    halo.start(volField.internalVector());
+
     NeoN::Input input = NeoN::TokenList({std::string("linear")});
     auto linear = nnfvcc::SurfaceInterpolation<Vec3>(exec, mesh, input);
     const auto weight = linear.weight(volField);
@@ -228,8 +651,8 @@ nnfvcc::SurfaceField<scalar> flux(const nnfvcc::VolumeField<Vec3>& volField)
     NeoN::fill(faceFlux.internalVector(), NeoN::zero<scalar>());
     NeoN::fill(faceFlux.boundaryData().value(), NeoN::zero<scalar>());
     const auto [owner, neighbour, weightIn, faceAreas, volFieldIn, volFieldBc, bSf] = views(
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
+        faceOwner,
+        faceNeighbour,
         weight.internalVector(),
         mesh.faceAreas(),
         volField.internalVector(),
@@ -263,7 +686,165 @@ nnfvcc::SurfaceField<scalar> flux(const nnfvcc::VolumeField<Vec3>& volField)
         }
     );
 
+    if (interfaces.empty()) return faceFlux;
+
+    // processor faces interpolate linearly between the owner and the received neighbour value
+    const auto [volFieldNei, procFaces, cells, bWeights] = views(
+        halo.wait(),
+        interfaces.receiveFaces(),
+        faceCells,
+        mesh.boundaryMesh().weights()
+    );
+    NeoN::parallelFor(
+        exec,
+        {0, procFaces.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            auto faceBCI = procFaces[i];
+            auto own = volFieldIn[cells[faceBCI]];
+            auto value = bWeights[faceBCI] * own + (1.0 - bWeights[faceBCI]) * volFieldNei[i];
+
+            faceFluxIn[nInternalFaces + faceBCI] = bSf[faceBCI] & value;
+            bvalue[faceBCI] = bSf[faceBCI] & value;
+        }
+    );
+
+    return faceFlux;
+}
+
+}
+
+nnfvcc::SurfaceField<scalar> flux(const nnfvcc::VolumeField<Vec3>& volField)
+{
+    return flux(volField, ProcessorInterfaces(volField.exec()));
+}
+
+nnfvcc::SurfaceField<scalar>
+flux(const nnfvcc::VolumeField<Vec3>& volField, const ProcessorInterfaces& interfaces)
+{
+    ScopedTimer timer("flux");
+    const auto& mesh = volField.mesh();
+    return detail::flux(
+        volField,
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.boundaryMesh().faceCells(),
+        interfaces
+    );
+}
+
+nnfvcc::SurfaceField<scalar>
+flux(const nnfvcc::VolumeField<Vec3>& volField, const MeshAdapter& meshAdapter)
+{
+    return flux(volField, meshAdapter, ProcessorInterfaces(volField.exec()));
+}
+
+nnfvcc::SurfaceField<scalar> flux(
+    const nnfvcc::VolumeField<Vec3>& volField,
+    const MeshAdapter& meshAdapter,
+    const ProcessorInterfaces& interfaces
+)
+{
+    ScopedTimer timer("flux");
+    const auto& conn = meshAdapter.connectivity();
+    return detail::flux(volField, conn.faceOwner, conn.faceNeighbour, conn.faceCells, interfaces);
+}
+
+namespace detail
+{
+
+/* @brief the flux with the internal face geometry in GeomType precision */
+template<typename GeomType>
+nnfvcc::SurfaceField<scalar> flux(
+    const SoAVolumeField& volField,
+    const Connectivity& conn,
+    const NeoN::Vector<GeomType>& faceAreasX,
+    const NeoN::Vector<GeomType>& faceAreasY,
+    const NeoN::Vector<GeomType>& faceAreasZ,
+    const NeoN::Vector<GeomType>& faceWeights
+)
+{
+    const auto exec = volField.exec();
+    const auto& nfMesh = volField.mesh();
+    const auto nInternalFaces = nfMesh.nInternalFaces();
+
+    auto surfaceBCs = nnfvcc::createCalculatedBCs<nnfvcc::SurfaceBoundary<scalar>>(nfMesh);
+    auto faceFlux = nnfvcc::SurfaceField<scalar>(exec, "out", nfMesh, surfaceBCs);
+    auto [faceFluxIn, bvalue] = views(faceFlux.internalVector(), faceFlux.boundaryData().value());
+
+    const auto& internal = volField.internalVector();
+    const auto [owner, neighbour, weights, sfX, sfY, sfZ, x, y, z] = views(
+        conn.faceOwner,
+        conn.faceNeighbour,
+        faceWeights,
+        faceAreasX,
+        faceAreasY,
+        faceAreasZ,
+        internal.x(),
+        internal.y(),
+        internal.z()
+    );
+    NeoN::parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            auto own = static_cast<std::size_t>(owner[facei]);
+            auto nei = static_cast<std::size_t>(neighbour[facei]);
+            const auto w = static_cast<scalar>(weights[facei]);
+            const auto fX = static_cast<scalar>(sfX[facei]);
+            const auto fY = static_cast<scalar>(sfY[facei]);
+            const auto fZ = static_cast<scalar>(sfZ[facei]);
+
+            faceFluxIn[facei] = fX * (w * (x[own] - x[nei]) + x[nei])
+                              + fY * (w * (y[own] - y[nei]) + y[nei])
+                              + fZ * (w * (z[own] - z[nei]) + z[nei]);
+        }
+    );
+
+    const auto& boundary = volField.boundaryValue();
+    const auto [bx, by, bz, bSf] =
+        views(boundary.x(), boundary.y(), boundary.z(), nfMesh.boundaryMesh().sf());
+    NeoN::parallelFor(
+        exec,
+        {nInternalFaces, faceFluxIn.size()},
+        KOKKOS_LAMBDA(const size_t facei) {
+            auto faceBCI = facei - nInternalFaces;
+            const auto sf = bSf[faceBCI];
+            const auto value = sf[0] * bx[faceBCI] + sf[1] * by[faceBCI] + sf[2] * bz[faceBCI];
+
+            faceFluxIn[facei] = value;
+            bvalue[faceBCI] = value;
+        }
+    );
+
     return faceFlux;
 }
 
 }
+
+nnfvcc::SurfaceField<scalar> flux(const SoAVolumeField& volField, const MeshAdapter& mesh)
+{
+    ScopedTimer timer("flux");
+    if (mesh.singlePrecisionGeometry())
+    {
+        const auto& geometry = mesh.singlePrecisionFaceGeometry();
+        return detail::flux(
+            volField,
+            mesh.connectivity(),
+            geometry.sfX,
+            geometry.sfY,
+            geometry.sfZ,
+            geometry.weights
+        );
+    }
+    const auto& geometry = mesh.soaFaceGeometry();
+    return detail::flux(
+        volField,
+        mesh.connectivity(),
+        geometry.faceAreas.x(),
+        geometry.faceAreas.y(),
+        geometry.faceAreas.z(),
+        geometry.weights
+    );
+}
+
+}
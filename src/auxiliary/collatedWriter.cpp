@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <fstream>
+#include <limits>
+
+#include "FoamAdapter/auxiliary/collatedWriter.hpp"
+
+#include "Pstream.H"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+constexpr int nEntryValues = sizeof(CollatedEntry) / sizeof(std::int64_t);
+
+std::filesystem::path
+dataFile(const std::filesystem::path& dir, const std::string& field, int group)
+{
+    return dir / (field + "." + std::to_string(group));
+}
+
+std::filesystem::path indexFile(const std::filesystem::path& dir, const std::string& field)
+{
+    return dir / (field + ".index");
+}
+
+void writeIndex(const std::filesystem::path& file, const std::vector<CollatedEntry>& entries)
+{
+    std::ofstream os(file);
+    os << "# rank group offset nCells nBoundaryFaces valueBytes\n";
+    for (std::size_t rank = 0; rank < entries.size(); rank++)
+    {
+        const auto& e = entries[rank];
+        os << rank << " " << e.group << " " << e.offset << " " << e.nCells << " "
+           << e.nBoundaryFaces << " " << e.valueBytes << "\n";
+    }
+}
+
+std::vector<CollatedEntry> readIndex(const std::filesystem::path& file)
+{
+    std::vector<CollatedEntry> entries;
+    std::ifstream is(file);
+    is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    std::int64_t rank;
+    CollatedEntry e;
+    while (is >> rank >> e.group >> e.offset >> e.nCells >> e.nBoundaryFaces >> e.valueBytes)
+    {
+        entries.push_back(e);
+    }
+    return entries;
+}
+
+void checkEntry(const CollatedEntry& stored, const CollatedEntry& local, const std::string& field)
+{
+    if (stored.nCells != local.nCells || stored.nBoundaryFaces != local.nBoundaryFaces
+        || stored.valueBytes != local.valueBytes)
+    {
+        Foam::FatalError << "collated field " << field << " does not match the local mesh: "
+                         << stored.nCells << " cells and " << stored.nBoundaryFaces
+                         << " boundary faces of " << stored.valueBytes << " bytes, expected "
+                         << local.nCells << ", " << local.nBoundaryFaces << " and "
+                         << local.valueBytes << Foam::nl << Foam::abort(Foam::FatalError);
+    }
+}
+
+}
+
+CollatedWriter::CollatedWriter(const Foam::Time& runTime, int groupSize)
+    : runTime_(runTime), parallel_(Foam::Pstream::parRun())
+{
+    if (!parallel_) return;
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (groupSize > 0)
+    {
+        MPI_Comm_split(MPI_COMM_WORLD, rank / groupSize, rank, &groupComm_);
+    }
+    else
+    {
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &groupComm_);
+    }
+    // the group is named by the world rank of its first rank
+    group_ = rank;
+    MPI_Bcast(&group_, 1, MPI_INT, 0, groupComm_);
+}
+
+CollatedWriter::~CollatedWriter()
+{
+    if (groupComm_ != MPI_COMM_NULL) MPI_Comm_free(&groupComm_);
+}
+
+std::filesystem::path CollatedWriter::directory() const
+{
+    return std::filesystem::path(runTime_.globalPath()) / "collated" / runTime_.timeName();
+}
+
+bool CollatedWriter::contains(const std::string& fieldName) const
+{
+    int found = std::filesystem::exists(indexFile(directory(), fieldName));
+    // all ranks take the decision of the first one, which wrote the index
+    if (parallel_) MPI_Bcast(&found, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    return found;
+}
+
+void CollatedWriter::writeBytes(
+    const std::string& fieldName,
+    const char* data,
+    CollatedEntry local
+) const
+{
+    const auto dir = directory();
+    local.group = group_;
+
+    if (!parallel_)
+    {
+        std::filesystem::create_directories(dir);
+        std::ofstream os(dataFile(dir, fieldName, group_), std::ios::binary);
+        os.write(data, local.nBytes());
+        writeIndex(indexFile(dir, fieldName), {local});
+        return;
+    }
+
+    int groupRank;
+    MPI_Comm_rank(groupComm_, &groupRank);
+    std::int64_t nBytes = local.nBytes();
+    MPI_Exscan(&nBytes, &local.offset, 1, MPI_INT64_T, MPI_SUM, groupComm_);
+    // the result of MPI_Exscan is undefined on the first rank
+    if (groupRank == 0) local.offset = 0;
+
+    if (groupRank == 0)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+    }
+    MPI_Barrier(groupComm_);
+
+    if (nBytes > std::numeric_limits<int>::max())
+    {
+        Foam::FatalError << "collated write of " << fieldName << " exceeds 2GB per rank"
+                         << Foam::nl << Foam::abort(Foam::FatalError);
+    }
+    MPI_File fh;
+    const auto file = dataFile(dir, fieldName, group_);
+    MPI_File_open(
+        groupComm_,
+        file.c_str(),
+        MPI_MODE_WRONLY | MPI_MODE_CREATE,
+        MPI_INFO_NULL,
+        &fh
+    );
+    MPI_File_set_size(fh, 0);
+    MPI_File_write_at_all(fh, local.offset, data, nBytes, MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_close(&fh);
+
+    int rank, nRanks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+    std::vector<CollatedEntry> entries(rank == 0 ? nRanks : 0);
+    MPI_Gather(
+        &local,
+        nEntryValues,
+        MPI_INT64_T,
+        entries.data(),
+        nEntryValues,
+        MPI_INT64_T,
+        0,
+        MPI_COMM_WORLD
+    );
+    if (rank == 0) writeIndex(indexFile(dir, fieldName), entries);
+}
+
+bool CollatedWriter::readBytes(const std::string& fieldName, char* data, CollatedEntry local) const
+{
+    const auto dir = directory();
+
+    if (!parallel_)
+    {
+        if (!std::filesystem::exists(indexFile(dir, fieldName))) return false;
+        const auto entries = readIndex(indexFile(dir, fieldName));
+        if (entries.size() != 1)
+        {
+            Foam::FatalError << "collated field " << fieldName << " was written by "
+                             << entries.size() << " ranks, the run is serial" << Foam::nl
+                             << Foam::abort(Foam::FatalError);
+        }
+        checkEntry(entries[0], local, fieldName);
+        std::ifstream is(dataFile(dir, fieldName, entries[0].group), std::ios::binary);
+        is.read(data, entries[0].nBytes());
+        return true;
+    }
+
+    // the first rank reads the index and scatters the entries, the data is read independently
+    // since the grouping of the run may differ from the one that wrote the files
+    int rank, nRanks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+    std::vector<CollatedEntry> entries;
+    int found = 0;
+    if (rank == 0 && std::filesystem::exists(indexFile(dir, fieldName)))
+    {
+        entries = readIndex(indexFile(dir, fieldName));
+        found = 1;
+        if (entries.size() != static_cast<std::size_t>(nRanks))
+        {
+            Foam::FatalError << "collated field " << fieldName << " was written by "
+                             << entries.size() << " ranks, the run uses " << nRanks
+                             << Foam::nl << Foam::abort(Foam::FatalError);
+        }
+    }
+    MPI_Bcast(&found, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if (!found) return false;
+
+    CollatedEntry stored;
+    MPI_Scatter(
+        entries.data(),
+        nEntryValues,
+        MPI_INT64_T,
+        &stored,
+        nEntryValues,
+        MPI_INT64_T,
+        0,
+        MPI_COMM_WORLD
+    );
+    checkEntry(stored, local, fieldName);
+
+    MPI_File fh;
+    const auto file = dataFile(dir, fieldName, stored.group);
+    MPI_File_open(MPI_COMM_SELF, file.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+    MPI_File_read_at(fh, stored.offset, data, stored.nBytes(), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_close(&fh);
+    return true;
+}
+
+}
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include "FoamAdapter/auxiliary/firstTouch.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+bool firstTouchEnabled = true;
+
+}
+
+void enableParallelFirstTouch(bool enable) { firstTouchEnabled = enable; }
+
+bool parallelFirstTouch(const NeoN::Executor& exec)
+{
+    return firstTouchEnabled && std::holds_alternative<NeoN::CPUExecutor>(exec);
+}
+
+}
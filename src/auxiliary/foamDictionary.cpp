@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2024 FoamAdapter authors
 
 #include "FoamAdapter/auxiliary/convert.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
 
 #include "vector.H"
 #include <functional>
@@ -85,6 +86,7 @@ void readFoamDictionary(const Foam::dictionary& dict, NeoN::Dictionary& neoDict)
 
 NeoN::Dictionary convert(const Foam::dictionary& dict)
 {
+    ScopedTimer timer("convertDictionary");
     NeoN::Dictionary neoDict;
     readFoamDictionary(dict, neoDict);
     return neoDict;
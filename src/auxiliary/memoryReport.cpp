@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "FoamAdapter/auxiliary/memoryReport.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+std::string formatBytes(std::size_t bytes)
+{
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0) << " MiB";
+    return os.str();
+}
+
+void allocateCallback(
+    const Kokkos::Tools::SpaceHandle handle,
+    const char*,
+    const void*,
+    const std::uint64_t size
+)
+{
+    MemoryReport::instance().allocate(handle.name, size);
+}
+
+void deallocateCallback(
+    const Kokkos::Tools::SpaceHandle handle,
+    const char*,
+    const void*,
+    const std::uint64_t size
+)
+{
+    MemoryReport::instance().deallocate(handle.name, size);
+}
+
+}
+
+MemoryReport& MemoryReport::instance()
+{
+    static MemoryReport report;
+    return report;
+}
+
+void MemoryReport::enable()
+{
+    if (enabled_) return;
+    enabled_ = true;
+    Kokkos::Tools::Experimental::set_allocate_data_callback(allocateCallback);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(deallocateCallback);
+}
+
+void MemoryReport::track(const std::string& category, const std::string& name, std::size_t bytes)
+{
+    objects_[{category, name}] = bytes;
+}
+
+void MemoryReport::untrack(const std::string& category, const std::string& name)
+{
+    objects_.erase({category, name});
+}
+
+void MemoryReport::allocate(const std::string& space, std::uint64_t bytes)
+{
+    auto& usage = spaces_[space];
+    usage.current += bytes;
+    usage.nAllocations++;
+    usage.peak = std::max(usage.peak, usage.current);
+    usage.stepPeak = std::max(usage.stepPeak, usage.current);
+}
+
+void MemoryReport::deallocate(const std::string& space, std::uint64_t bytes)
+{
+    auto& usage = spaces_[space];
+    // allocations made before the report was enabled are not accounted
+    usage.current = (usage.current > bytes) ? usage.current - bytes : 0;
+}
+
+std::size_t MemoryReport::peak(const std::string& space) const
+{
+    auto it = spaces_.find(space);
+    return (it != spaces_.end()) ? it->second.peak : 0;
+}
+
+void MemoryReport::sample(std::ostream& os, const std::string& timeName)
+{
+    os << "Memory high water mark of time " << timeName << ":";
+    for (auto& [space, usage] : spaces_)
+    {
+        os << " " << space << " " << formatBytes(usage.stepPeak);
+        usage.stepPeak = usage.current;
+    }
+    os << "\n";
+}
+
+void MemoryReport::print(std::ostream& os) const
+{
+    os << "\nMemory report\n"
+       << std::left << std::setw(16) << "memory space" << std::right << std::setw(16) << "current"
+       << std::setw(16) << "high water mark" << std::setw(14) << "allocations" << "\n";
+    for (const auto& [space, usage] : spaces_)
+    {
+        os << std::left << std::setw(16) << space << std::right << std::setw(16)
+           << formatBytes(usage.current) << std::setw(16) << formatBytes(usage.peak)
+           << std::setw(14) << usage.nAllocations << "\n";
+    }
+
+    std::map<std::string, std::size_t> categoryBytes;
+    std::size_t total = 0;
+    for (const auto& [key, bytes] : objects_)
+    {
+        categoryBytes[key.first] += bytes;
+        total += bytes;
+    }
+
+    os << "\n" << std::left << std::setw(40) << "object" << std::right << std::setw(16) << "size"
+       << "\n";
+    for (const auto& [category, bytes] : categoryBytes)
+    {
+        os << std::left << std::setw(40) << category << std::right << std::setw(16)
+           << formatBytes(bytes) << "\n";
+        for (const auto& [key, objectBytes] : objects_)
+        {
+            if (key.first != category) continue;
+            os << std::left << std::setw(40) << "  " + key.second << std::right << std::setw(16)
+               << formatBytes(objectBytes) << "\n";
+        }
+    }
+    os << std::left << std::setw(40) << "total of named objects" << std::right << std::setw(16)
+       << formatBytes(total) << "\n";
+
+    const auto& pool = vectorPoolStatistics();
+    if (pool.acquires > 0)
+    {
+        os << "\nvector pool: " << pool.acquires << " acquires, " << pool.hits
+           << " served from cache, " << formatBytes(pool.cachedBytes) << " cached, high water mark "
+           << formatBytes(pool.peakCachedBytes) << "\n";
+    }
+}
+
+std::size_t memoryUsage(const NeoN::UnstructuredMesh& mesh)
+{
+    const auto& bMesh = mesh.boundaryMesh();
+    return memoryUsage(mesh.points()) + memoryUsage(mesh.cellVolumes())
+         + memoryUsage(mesh.cellCentres()) + memoryUsage(mesh.faceAreas())
+         + memoryUsage(mesh.faceCentres()) + memoryUsage(mesh.magFaceAreas())
+         + memoryUsage(mesh.faceOwner()) + memoryUsage(mesh.faceNeighbour())
+         + memoryUsage(bMesh.faceCells()) + memoryUsage(bMesh.cf()) + memoryUsage(bMesh.cn())
+         + memoryUsage(bMesh.sf()) + memoryUsage(bMesh.magSf()) + memoryUsage(bMesh.nf())
+         + memoryUsage(bMesh.delta()) + memoryUsage(bMesh.weights())
+         + memoryUsage(bMesh.deltaCoeffs());
+}
+
+void trackMemory(const NeoN::UnstructuredMesh& mesh)
+{
+    auto& report = MemoryReport::instance();
+    if (!report.enabled()) return;
+
+    report.track("mesh", "points", memoryUsage(mesh.points()));
+    report.track("mesh", "cellVolumes", memoryUsage(mesh.cellVolumes()));
+    report.track("mesh", "cellCentres", memoryUsage(mesh.cellCentres()));
+    report.track("mesh", "faceAreas", memoryUsage(mesh.faceAreas()));
+    report.track("mesh", "faceCentres", memoryUsage(mesh.faceCentres()));
+    report.track("mesh", "magFaceAreas", memoryUsage(mesh.magFaceAreas()));
+    report.track("mesh", "faceOwner", memoryUsage(mesh.faceOwner()));
+    report.track("mesh", "faceNeighbour", memoryUsage(mesh.faceNeighbour()));
+
+    const auto& bMesh = mesh.boundaryMesh();
+    report.track("boundaryMesh", "faceCells", memoryUsage(bMesh.faceCells()));
+    report.track("boundaryMesh", "cf", memoryUsage(bMesh.cf()));
+    report.track("boundaryMesh", "cn", memoryUsage(bMesh.cn()));
+    report.track("boundaryMesh", "sf", memoryUsage(bMesh.sf()));
+    report.track("boundaryMesh", "magSf", memoryUsage(bMesh.magSf()));
+    report.track("boundaryMesh", "nf", memoryUsage(bMesh.nf()));
+    report.track("boundaryMesh", "delta", memoryUsage(bMesh.delta()));
+    report.track("boundaryMesh", "weights", memoryUsage(bMesh.weights()));
+    report.track("boundaryMesh", "deltaCoeffs", memoryUsage(bMesh.deltaCoeffs()));
+}
+
+}
@@ -1,17 +1,36 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: 2023-2025 FoamAdapter authors
 
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#ifdef KOKKOS_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 #include "FoamAdapter/auxiliary/setup.hpp"
+#include "FoamAdapter/auxiliary/firstTouch.hpp"
 #include "FoamAdapter/datastructures/meshAdapter.hpp"
 #include "FoamAdapter/auxiliary/readers.hpp"
+#include "FoamAdapter/auxiliary/memoryReport.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
 
 #include "fvc.H"
+#include "IFstream.H"
 
 namespace FoamAdapter
 {
 
 void setDeltaT(Foam::Time& ofRunTime, RunTime& nfRunTime, Foam::scalar coNum)
 {
+    // the Courant number is computed per subdomain
+    coNum = Foam::returnReduce(coNum, Foam::maxOp<Foam::scalar>());
     Foam::scalar maxDeltaTFact = nfRunTime.maxCo / (coNum + Foam::SMALL);
     Foam::scalar deltaTFact = Foam::min(Foam::min(maxDeltaTFact, 1.0 + 0.1 * maxDeltaTFact), 1.2);
 
@@ -73,10 +92,109 @@ NeoN::Executor createExecutor(const Foam::word& execName)
     return NeoN::SerialExecutor();
 }
 
+ExecutorSettings readExecutorSettings(const Foam::dictionary& controlDict)
+{
+    if (!controlDict.isDict("executor"))
+    {
+        return {.type = controlDict.get<Foam::word>("executor")};
+    }
+    const Foam::dictionary& dict = controlDict.subDict("executor");
+    if (dict.found("bind") || dict.found("places"))
+    {
+        std::cout << __FILE__ << ":\n\tbind and places of the executor are ignored, the OpenMP"
+                  << " runtime reads OMP_PROC_BIND and OMP_PLACES before main, set them in the"
+                  << " environment of the job instead\n";
+    }
+    return {
+        .type = dict.get<Foam::word>("type"),
+        .numThreads = dict.getOrDefault<Foam::label>("numThreads", 0),
+        .device = dict.getOrDefault<Foam::label>("device", -1),
+        .firstTouch = dict.getOrDefault<bool>("firstTouch", true)
+    };
+}
+
+namespace
+{
+
+/* @brief sets the environment variable unless it is set already
+ * @return true if the variable was set
+ */
+bool setDefaultEnv(const char* name, const std::string& value)
+{
+    if (value.empty() || std::getenv(name)) return false;
+    setenv(name, value.c_str(), 1);
+    return true;
+}
+
+#ifdef KOKKOS_ENABLE_OPENMP
+
+/* @brief warns if the binding of the OpenMP runtime differs from OMP_PROC_BIND */
+void checkProcBind()
+{
+    const char* env = std::getenv("OMP_PROC_BIND");
+    if (!env) return;
+    // the first entry of the list applies to the outermost parallel region
+    std::string requested(env);
+    requested = requested.substr(0, requested.find(','));
+    std::transform(requested.begin(), requested.end(), requested.begin(), ::tolower);
+
+    const std::map<omp_proc_bind_t, std::vector<std::string>> names {
+        {omp_proc_bind_false, {"false"}},
+        {omp_proc_bind_true, {"true"}},
+        {omp_proc_bind_master, {"master", "primary"}},
+        {omp_proc_bind_close, {"close"}},
+        {omp_proc_bind_spread, {"spread"}}
+    };
+    const auto it = names.find(omp_get_proc_bind());
+    if (it == names.end()) return;
+    if (std::find(it->second.begin(), it->second.end(), requested) == it->second.end())
+    {
+        std::cout << __FILE__ << ":\n\tOMP_PROC_BIND=" << env << " is not applied, the OpenMP"
+                  << " runtime binds " << it->second.front() << "\n";
+    }
+}
+
+#endif
+
+}
+
+void initializeKokkos(int& argc, char* argv[])
+{
+    std::filesystem::path caseDir = ".";
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "-case") caseDir = argv[i + 1];
+    }
+
+    const auto file = caseDir / "system" / "controlDict";
+    if (std::filesystem::exists(file))
+    {
+        Foam::IFstream is(file.string());
+        const Foam::dictionary controlDict(is);
+        if (controlDict.found("executor"))
+        {
+            const auto settings = readExecutorSettings(controlDict);
+            if (settings.numThreads > 0)
+            {
+                setDefaultEnv("KOKKOS_NUM_THREADS", std::to_string(settings.numThreads));
+            }
+            if (settings.device >= 0)
+            {
+                setDefaultEnv("KOKKOS_DEVICE_ID", std::to_string(settings.device));
+            }
+            enableParallelFirstTouch(settings.firstTouch);
+        }
+    }
+
+    Kokkos::initialize(argc, argv);
+#ifdef KOKKOS_ENABLE_OPENMP
+    checkProcBind();
+#endif
+}
+
 NeoN::Executor createExecutor(const Foam::dictionary& dict)
 {
-    auto execName = dict.get<Foam::word>("executor");
-    return createExecutor(execName);
+    return createExecutor(readExecutorSettings(dict).type);
 }
 
 FoamAdapter::RunTime createAdapterRunTime(const Foam::Time& in)
@@ -85,8 +203,35 @@ FoamAdapter::RunTime createAdapterRunTime(const Foam::Time& in)
     return createAdapterRunTime(in, exec);
 }
 
+std::shared_ptr<SolverTelemetry> createSolverTelemetry(const Foam::Time& in)
+{
+    if (!in.controlDict().getOrDefault("solverTelemetry", false))
+    {
+        return nullptr;
+    }
+    std::filesystem::path file = std::filesystem::path(in.path()) / "postProcessing"
+                               / "solverTelemetry" / in.timeName() / "solverTelemetry.jsonl";
+    Foam::Info << "Writing solver telemetry to " << file.string() << Foam::endl;
+    return std::make_shared<SolverTelemetry>(file);
+}
+
+std::shared_ptr<CollatedWriter> createCollatedWriter(const Foam::Time& runTime)
+{
+    if (!runTime.controlDict().getOrDefault("collatedWrite", false))
+    {
+        return nullptr;
+    }
+    const int groupSize = runTime.controlDict().getOrDefault<Foam::label>("collatedGroupSize", 0);
+    Foam::Info << "Writing NeoN fields collated per "
+               << (groupSize > 0 ? std::to_string(groupSize) + " ranks" : std::string("node"))
+               << Foam::endl;
+    return std::make_shared<CollatedWriter>(runTime, groupSize);
+}
+
 RunTime createAdapterRunTime(const Foam::Time& in, const NeoN::Executor exec)
 {
+    TimingTree::enable(in.controlDict().getOrDefault("timingTree", false));
+    ScopedTimer timer("createAdapterRunTime");
     std::cout << __FILE__ << ":"
               << "Creating FoamAdapter runTime\n";
     std::unique_ptr<MeshAdapter> meshPtr = createMesh(exec, in);
@@ -106,8 +251,53 @@ RunTime createAdapterRunTime(const Foam::Time& in, const NeoN::Executor exec)
         .maxDeltaT = in.controlDict().getOrDefault<Foam::scalar>("maxDeltaT", Foam::GREAT),
         .controlDict = convert(in.controlDict()),
         .fvSolutionDict = convert(mesh.solutionDict()),
-        .fvSchemesDict = convert(mesh.schemesDict())
+        .fvSchemesDict = convert(mesh.schemesDict()),
+        .telemetry = createSolverTelemetry(in),
+        .collatedWriter = createCollatedWriter(in)
     };
 }
 
+void printExecutionTime(const Foam::Time& runTime)
+{
+    runTime.printExecutionTime(Foam::Info);
+    if (TimingTree::enabled() && Foam::Pstream::master())
+    {
+        TimingTree::instance().print(std::cout);
+    }
+}
+
+void addMemoryReportOption()
+{
+    Foam::argList::addBoolOption(
+        "memoryReport",
+        "Report the memory high water mark per time step and a breakdown at exit"
+    );
+}
+
+void enableMemoryReport(const Foam::argList& args)
+{
+    if (args.found("memoryReport"))
+    {
+        MemoryReport::instance().enable();
+    }
+}
+
+void printMemoryUsage(const Foam::Time& runTime)
+{
+    auto& report = MemoryReport::instance();
+    if (report.enabled() && Foam::Pstream::master())
+    {
+        report.sample(std::cout, runTime.timeName());
+    }
+}
+
+void printMemoryReport()
+{
+    auto& report = MemoryReport::instance();
+    if (report.enabled() && Foam::Pstream::master())
+    {
+        report.print(std::cout);
+    }
+}
+
 }
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "FoamAdapter/auxiliary/solverTelemetry.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+std::string quote(const std::string& value)
+{
+    std::string result = "\"";
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+    return result + "\"";
+}
+
+template<typename T>
+std::string jsonValue(const std::optional<T>& value)
+{
+    if (!value) return "null";
+    std::ostringstream os;
+    os << std::setprecision(10) << *value;
+    return os.str();
+}
+
+}
+
+NeoN::scalar SolveRecord::flopsPerIteration() const
+{
+    // sparse matrix vector products and vector operations (dot, axpy) per iteration
+    static const std::map<std::string, std::pair<NeoN::scalar, NeoN::scalar>> krylovWork = {
+        {"solver::Cg", {1.0, 5.0}},
+        {"solver::Bicg", {2.0, 7.0}},
+        {"solver::Bicgstab", {2.0, 11.0}},
+        {"batched", {2.0, 11.0}},
+        {"mixedPrecision", {2.0, 11.0}},
+    };
+    auto it = krylovWork.find(solver);
+    if (it == krylovWork.end())
+    {
+        return 0.0;
+    }
+    const auto [nSpmv, nVectorOps] = it->second;
+    // two flops per non-zero and per vector entry
+    return nRhs * (nSpmv * 2.0 * nNonZeros + nVectorOps * 2.0 * nRows);
+}
+
+std::optional<NeoN::scalar> SolveRecord::gflops() const
+{
+    const auto flops = flopsPerIteration();
+    if (flops == 0.0 || timings.solve <= 0.0)
+    {
+        return {};
+    }
+    return flops * stats.numIter / timings.solve * 1e-9;
+}
+
+std::string toJson(const SolveRecord& record)
+{
+    std::ostringstream os;
+    os << std::setprecision(10) << "{\"field\":" << quote(record.field) << ",\"time\":" << record.t
+       << ",\"deltaT\":" << record.dt << ",\"solver\":" << quote(record.solver)
+       << ",\"nRows\":" << record.nRows << ",\"nNonZeros\":" << record.nNonZeros
+       << ",\"nRhs\":" << record.nRhs
+       << ",\"assemblyTime\":" << jsonValue(record.timings.assembly)
+       << ",\"preconditionerSetupTime\":" << jsonValue(record.timings.setup)
+       << ",\"solveTime\":" << record.timings.solve << ",\"iterations\":" << record.stats.numIter
+       << ",\"initialResidual\":" << record.stats.initResNorm
+       << ",\"finalResidual\":" << record.stats.finalResNorm
+       << ",\"gflops\":" << jsonValue(record.gflops()) << "}";
+    return os.str();
+}
+
+SolverTelemetry::SolverTelemetry(const std::filesystem::path& file) : file_(file)
+{
+    std::filesystem::create_directories(file_.parent_path());
+    stream_.open(file_, std::ios::app);
+    if (!stream_)
+    {
+        throw std::runtime_error("Could not open solver telemetry file " + file_.string());
+    }
+}
+
+void SolverTelemetry::record(const SolveRecord& record)
+{
+    // flush every record, so the file stays usable if the run is aborted
+    stream_ << toJson(record) << std::endl;
+}
+
+}
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <type_traits>
+#include <variant>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/auxiliary/timeStepControl.hpp"
+#include "FoamAdapter/auxiliary/setup.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
+#include "Kokkos_Core.hpp"
+
+namespace FoamAdapter
+{
+
+using scalar = NeoN::scalar;
+
+CourantTimeStepControl::CourantTimeStepControl(const MeshAdapter& mesh)
+    : mesh_(mesh), sumPhi_(mesh.exec(), mesh.nfMesh().nCells())
+    , deviceCoNum_(mesh.exec(), 1, 0.0)
+{}
+
+void CourantTimeStepControl::start(const fvcc::SurfaceField<scalar>& phi, scalar dt)
+{
+    ScopedTimer timer("courantNumber");
+    const auto& nfMesh = mesh_.nfMesh();
+    const auto& conn = mesh_.connectivity();
+    const auto nInternalFaces = nfMesh.nInternalFaces();
+    const auto exec = phi.exec();
+
+    NeoN::fill(sumPhi_, 0.0);
+    auto sumPhi = sumPhi_.view();
+    const auto [owner, neighbour, faceCells, iPhi, bPhi] = views(
+        conn.faceOwner,
+        conn.faceNeighbour,
+        conn.faceCells,
+        phi.internalVector(),
+        phi.boundaryData().value()
+    );
+    NeoN::parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t facei) {
+            const auto magPhi = Kokkos::abs(iPhi[facei]);
+            Kokkos::atomic_add(&sumPhi[owner[facei]], magPhi);
+            Kokkos::atomic_add(&sumPhi[neighbour[facei]], magPhi);
+        }
+    );
+    NeoN::parallelFor(
+        exec,
+        {0, bPhi.size()},
+        KOKKOS_LAMBDA(const size_t bfacei) {
+            Kokkos::atomic_add(&sumPhi[faceCells[bfacei]], Kokkos::abs(bPhi[bfacei]));
+        }
+    );
+
+    // the reduction writes into device memory, hence Kokkos does not wait for the result
+    const auto vol = nfMesh.cellVolumes().view();
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecSpace = typename std::decay_t<decltype(e)>::exec;
+            using MaxReducer = Kokkos::Max<scalar, typename ExecSpace::memory_space>;
+            typename MaxReducer::result_view_type result(deviceCoNum_.data());
+            Kokkos::parallel_reduce(
+                "courantNumber",
+                Kokkos::RangePolicy<ExecSpace>(0, sumPhi.size()),
+                KOKKOS_LAMBDA(const size_t celli, scalar& maxCo) {
+                    const auto co = 0.5 * sumPhi[celli] / vol[celli] * dt;
+                    maxCo = co > maxCo ? co : maxCo;
+                },
+                MaxReducer(result)
+            );
+        },
+        exec
+    );
+    started_ = true;
+}
+
+void CourantTimeStepControl::setDeltaT(Foam::Time& ofRunTime, RunTime& nfRunTime)
+{
+    if (!started_)
+    {
+        Foam::FatalError << "CourantTimeStepControl::setDeltaT called without start"
+                         << Foam::nl << Foam::abort(Foam::FatalError);
+    }
+    {
+        ScopedTimer timer("courantNumberWait");
+        // the only synchronization of the time step control
+        coNum_ = deviceCoNum_.copyToHost().view()[0];
+    }
+    started_ = false;
+    FoamAdapter::setDeltaT(ofRunTime, nfRunTime, coNum_);
+}
+
+}
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <iomanip>
+#include <utility>
+
+#include "FoamAdapter/auxiliary/timing.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+NeoN::scalar secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<NeoN::scalar>(std::chrono::steady_clock::now() - start).count();
+}
+
+void printNode(std::ostream& os, const TimingNode& node, int depth, NeoN::scalar parentSeconds)
+{
+    const std::string label = std::string(2 * depth, ' ') + node.name;
+    os << std::left << std::setw(48) << label << std::right << std::setw(12) << std::fixed
+       << std::setprecision(4) << node.seconds << std::setw(10) << node.calls;
+    if (parentSeconds > 0.0)
+    {
+        os << std::setw(9) << std::setprecision(1) << 100.0 * node.seconds / parentSeconds << "%";
+    }
+    os << "\n";
+
+    NeoN::scalar childSeconds = 0.0;
+    for (const auto& child : node.children)
+    {
+        printNode(os, *child, depth + 1, node.seconds);
+        childSeconds += child->seconds;
+    }
+    // time spent outside of any named child region
+    if (!node.children.empty() && node.seconds > childSeconds)
+    {
+        const std::string other = std::string(2 * (depth + 1), ' ') + "(other)";
+        os << std::left << std::setw(48) << other << std::right << std::setw(12)
+           << std::setprecision(4) << node.seconds - childSeconds << std::setw(10) << ""
+           << std::setw(9) << std::setprecision(1)
+           << 100.0 * (node.seconds - childSeconds) / node.seconds << "%\n";
+    }
+}
+
+}
+
+Timer::Timer() : start_(std::chrono::steady_clock::now()) {}
+
+NeoN::scalar Timer::elapsed() const
+{
+    Kokkos::fence();
+    return secondsSince(start_);
+}
+
+TimingNode& TimingNode::child(const std::string& childName)
+{
+    for (auto& c : children)
+    {
+        if (c->name == childName) return *c;
+    }
+    auto node = std::make_unique<TimingNode>();
+    node->name = childName;
+    node->parent = this;
+    children.push_back(std::move(node));
+    return *children.back();
+}
+
+TimingTree& TimingTree::instance()
+{
+    static TimingTree tree;
+    return tree;
+}
+
+TimingTree::TimingTree() : root_ {.name = "total"}, current_(&root_) {}
+
+void TimingTree::push(const std::string& name) { current_ = &current_->child(name); }
+
+void TimingTree::pop(NeoN::scalar seconds)
+{
+    current_->seconds += seconds;
+    current_->calls++;
+    if (current_->parent) current_ = current_->parent;
+}
+
+void TimingTree::reset()
+{
+    root_.children.clear();
+    root_.seconds = 0.0;
+    root_.calls = 0;
+    current_ = &root_;
+}
+
+void TimingTree::print(std::ostream& os) const
+{
+    NeoN::scalar total = 0.0;
+    for (const auto& child : root_.children)
+    {
+        total += child->seconds;
+    }
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << "\nTiming tree\n"
+       << std::left << std::setw(48) << "region" << std::right << std::setw(12) << "time [s]"
+       << std::setw(10) << "calls" << std::setw(10) << "parent" << "\n";
+    for (const auto& child : root_.children)
+    {
+        printNode(os, *child, 0, total);
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+ScopedTimer::ScopedTimer(const char* name)
+    : kokkosRegion_(Kokkos::Profiling::profileLibraryLoaded()), timed_(TimingTree::enabled())
+{
+    // the name is only converted if it is used
+    if (kokkosRegion_ || timed_) start(name);
+}
+
+ScopedTimer::ScopedTimer(const std::string& name)
+    : kokkosRegion_(Kokkos::Profiling::profileLibraryLoaded()), timed_(TimingTree::enabled())
+{
+    if (kokkosRegion_ || timed_) start(name);
+}
+
+void ScopedTimer::start(const std::string& name)
+{
+    if (kokkosRegion_)
+    {
+        Kokkos::Profiling::pushRegion(name);
+    }
+    if (timed_)
+    {
+        TimingTree::instance().push(name);
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    if (timed_)
+    {
+        Kokkos::fence();
+        TimingTree::instance().pop(secondsSince(start_));
+    }
+    if (kokkosRegion_)
+    {
+        Kokkos::Profiling::popRegion();
+    }
+}
+
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+std::vector<std::function<void()>>& poolClears()
+{
+    static std::vector<std::function<void()>> clears;
+    return clears;
+}
+
+}
+
+VectorPoolStatistics& vectorPoolStatistics()
+{
+    static VectorPoolStatistics stats;
+    return stats;
+}
+
+void clearVectorPools()
+{
+    for (const auto& clear : poolClears())
+    {
+        clear();
+    }
+}
+
+void detail::registerVectorPool(std::function<void()> clear)
+{
+    auto& clears = poolClears();
+    if (clears.empty()) Kokkos::push_finalize_hook(clearVectorPools);
+    clears.push_back(std::move(clear));
+}
+
+}
@@ -2,12 +2,14 @@
 // SPDX-FileCopyrightText: 2023 FoamAdapter authors
 //
 #include "FoamAdapter/auxiliary/writers.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
 
 namespace FoamAdapter
 {
 
 void write(const NeoN::scalarVector& sf, const Foam::fvMesh& mesh, const std::string fieldName)
 {
+    ScopedTimer timer("write");
     Foam::volScalarField* field = mesh.getObjectPtr<Foam::volScalarField>(fieldName);
     if (field)
     {
@@ -38,6 +40,7 @@ void write(
     const std::string fieldName
 )
 {
+    ScopedTimer timer("write");
     Foam::volVectorField* field = mesh.getObjectPtr<Foam::volVectorField>(fieldName);
     if (field)
     {
@@ -70,6 +73,7 @@ void write(
     const std::string fieldName
 )
 {
+    ScopedTimer timer("write");
     Foam::volScalarField foamField(
         Foam::IOobject(
             fieldName,
@@ -104,6 +108,7 @@ void write(
     const std::string fieldName
 )
 {
+    ScopedTimer timer("write");
     Foam::volVectorField foamField(
         Foam::IOobject(
             fieldName,
@@ -134,4 +139,44 @@ void write(
     foamField.write();
 }
 
+void write(const SoAVolumeField& volField, const Foam::fvMesh& mesh, const std::string fieldName)
+{
+    ScopedTimer timer("write");
+    Foam::volVectorField foamField(
+        Foam::IOobject(
+            fieldName,
+            mesh.time().timeName(),
+            mesh,
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::AUTO_WRITE
+        ),
+        mesh,
+        Foam::dimensionedVector(Foam::dimless, Foam::Zero)
+    );
+
+    auto hostInternal = volField.internalVector().copyToHost();
+    const auto [x, y, z] = views(hostInternal.x(), hostInternal.y(), hostInternal.z());
+    auto& foamInternal = foamField.primitiveFieldRef();
+    NF_ASSERT_EQUAL(foamInternal.size(), x.size());
+    forAll(foamInternal, celli)
+    {
+        foamInternal[celli] = Foam::vector(x[celli], y[celli], z[celli]);
+    }
+
+    auto hostBoundary = volField.boundaryValue().copyToHost();
+    const auto [bx, by, bz] = views(hostBoundary.x(), hostBoundary.y(), hostBoundary.z());
+    // the boundary values are flattened in the order of the patches
+    std::size_t i = 0;
+    forAll(foamField.boundaryField(), patchi)
+    {
+        auto& foamFieldPatch = foamField.boundaryFieldRef()[patchi];
+        forAll(foamFieldPatch, bfacei)
+        {
+            foamFieldPatch[bfacei] = Foam::vector(bx[i], by[i], bz[i]);
+            i++;
+        }
+    }
+    foamField.write();
+}
+
 }
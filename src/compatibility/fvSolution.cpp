@@ -8,7 +8,10 @@
 
 
 #include "FoamAdapter/compatibility/fvSolution.hpp"
+#include <algorithm>
+#include <any>
 #include <map>
+#include <vector>
 #include <NeoN/core/primitives/scalar.hpp>
 #include <NeoN/core/primitives/label.hpp>
 
@@ -16,6 +19,182 @@
 namespace FoamAdapter
 {
 
+namespace
+{
+
+/* @brief maps an OpenFOAM GAMG smoother to a Ginkgo preconditioner applied by the smoother */
+NeoN::Dictionary smootherConfig(const std::string& smoother)
+{
+    static const std::map<std::string, NeoN::Dictionary> smootherMap = {
+        {"GaussSeidel",
+         NeoN::Dictionary(
+             {{std::string("type"), std::string("preconditioner::GaussSeidel")},
+              {std::string("symmetric"), false}}
+         )},
+        {"symGaussSeidel",
+         NeoN::Dictionary(
+             {{std::string("type"), std::string("preconditioner::GaussSeidel")},
+              {std::string("symmetric"), true}}
+         )},
+        {"DILU",
+         NeoN::Dictionary(
+             {{std::string("type"), std::string("preconditioner::Ilu")},
+              {std::string("factorization"),
+               NeoN::Dictionary({{std::string("type"), std::string("factorization::ParIlu")}})}}
+         )},
+    };
+    // smoothers without a Ginkgo counterpart are replaced by the closest available one. The
+    // pressure equation of the solvers is negative definite, which an incomplete Cholesky
+    // smoother cannot factorize, hence the DIC smoothers fall back to symmetric Gauss-Seidel
+    // that works for either sign of the diagonal
+    static const std::map<std::string, std::string> aliases = {
+        {"nonBlockingGaussSeidel", "GaussSeidel"},
+        {"DIC", "symGaussSeidel"},
+        {"DICGaussSeidel", "symGaussSeidel"},
+        {"DILUGaussSeidel", "DILU"},
+    };
+
+    auto alias = aliases.find(smoother);
+    auto it = smootherMap.find(alias != aliases.end() ? alias->second : smoother);
+    if (it != smootherMap.end())
+    {
+        return it->second;
+    }
+    std::cout << __FILE__ << ":\n\tunknown GAMG smoother " << smoother
+              << ", using preconditioner::Jacobi\n";
+    return NeoN::Dictionary(
+        {{std::string("type"), std::string("preconditioner::Jacobi")},
+         {std::string("max_block_size"), 1}}
+    );
+}
+
+/* @brief a fixed number of smoothing sweeps, ie. a Richardson iteration with the smoother */
+NeoN::Dictionary smootherSweeps(const NeoN::Dictionary& smoother, NeoN::localIdx nSweeps)
+{
+    return NeoN::Dictionary(
+        {{std::string("type"), std::string("solver::Ir")},
+         {std::string("solver"), smoother},
+         {std::string("relaxation_factor"), NeoN::scalar(1.0)},
+         {std::string("default_initial_guess"), std::string("provided")},
+         {std::string("criteria"),
+          NeoN::Dictionary({{std::string("iteration"), static_cast<int>(nSweeps)}})}}
+    );
+}
+
+// OpenFOAM GAMG entries consumed by mapGAMG
+const std::vector<std::string> gamgControls = {
+    "smoother",
+    "nCellsInCoarsestLevel",
+    "mergeLevels",
+    "maxLevels",
+    "nPreSweeps",
+    "nPostSweeps",
+    "nFinestSweeps",
+    "preSweepsLevelMultiplier",
+    "postSweepsLevelMultiplier",
+    "maxPreSweeps",
+    "maxPostSweeps",
+    "nVcycles",
+    "cacheAgglomeration",
+    "agglomerator",
+    "directSolveCoarsest",
+    "scaleCorrection",
+    "interpolateCorrection",
+};
+
+void removeGAMGControls(NeoN::Dictionary& dict)
+{
+    for (const auto& key : gamgControls)
+    {
+        if (dict.contains(key))
+        {
+            dict.remove(key);
+        }
+    }
+}
+
+/* @brief a GAMG V-cycle applied nVcycles times as preconditioner */
+NeoN::Dictionary gamgPreconditioner(const NeoN::Dictionary& gamgDict)
+{
+    NeoN::Dictionary preconditionerDict = mapGAMG(gamgDict);
+    preconditionerDict.insert("type", std::string("solver::Multigrid"));
+    // OpenFOAM applies two V-cycles per preconditioner call by default
+    preconditionerDict.insert(
+        "criteria",
+        NeoN::Dictionary(
+            {{std::string("iteration"), static_cast<int>(readIndex(gamgDict, "nVcycles", 2))}}
+        )
+    );
+    return preconditionerDict;
+}
+
+}
+
+NeoN::Dictionary mapGAMG(const NeoN::Dictionary& gamgDict)
+{
+    const auto smoother = gamgDict.contains("smoother") ? gamgDict.get<std::string>("smoother")
+                                                        : std::string("GaussSeidel");
+    const auto smootherDict = smootherConfig(smoother);
+    // OpenFOAM defaults, see GAMGSolver.C
+    const auto nPreSweeps = readIndex(gamgDict, "nPreSweeps", 0);
+    const auto nPostSweeps = readIndex(gamgDict, "nPostSweeps", 2);
+    const auto nCellsInCoarsestLevel = readIndex(gamgDict, "nCellsInCoarsestLevel", 10);
+    const auto maxLevels = readIndex(gamgDict, "maxLevels", 50);
+    const auto mergeLevels = readIndex(gamgDict, "mergeLevels", 1);
+    if (mergeLevels > 1)
+    {
+        std::cout << __FILE__ << ":\n\tmergeLevels " << mergeLevels
+                  << " is not supported, Ginkgo's parallel graph match agglomerates pairs of "
+                     "cells on every level\n";
+    }
+    if (!readSwitch(gamgDict, "cacheAgglomeration", true))
+    {
+        std::cout << __FILE__ << ":\n\tcacheAgglomeration off is ignored, the hierarchy is "
+                     "generated with the solver\n";
+    }
+
+    // the coarsest level is solved iteratively, directSolveCoarsest tightens the tolerance
+    const NeoN::scalar coarsestRelTol =
+        readSwitch(gamgDict, "directSolveCoarsest", false) ? 1e-10 : 1e-2;
+    NeoN::Dictionary coarsestSolver(
+        {{std::string("type"), std::string("solver::Bicgstab")},
+         {std::string("preconditioner"),
+          NeoN::Dictionary(
+              {{std::string("type"), std::string("preconditioner::Jacobi")},
+               {std::string("max_block_size"), 1}}
+          )},
+         {std::string("criteria"),
+          NeoN::Dictionary(
+              {{std::string("iteration"), 100},
+               {std::string("relative_residual_norm"), coarsestRelTol}}
+          )}}
+    );
+
+    NeoN::Dictionary multigridDict(
+        {{std::string("mg_level"),
+          NeoN::Dictionary(
+              {{std::string("type"), std::string("multigrid::Pgm")},
+               {std::string("deterministic"), true}}
+          )},
+         {std::string("cycle"), std::string("v")},
+         {std::string("max_levels"), static_cast<int>(maxLevels)},
+         {std::string("min_coarse_rows"), static_cast<int>(nCellsInCoarsestLevel)},
+         {std::string("post_uses_pre"), false},
+         {std::string("coarsest_solver"), coarsestSolver},
+         {std::string("default_initial_guess"), std::string("zero")}}
+    );
+    // a smoother with zero sweeps is left out, Ginkgo then skips the smoothing step
+    if (nPreSweeps > 0)
+    {
+        multigridDict.insert("pre_smoother", smootherSweeps(smootherDict, nPreSweeps));
+    }
+    if (nPostSweeps > 0)
+    {
+        multigridDict.insert("post_smoother", smootherSweeps(smootherDict, nPostSweeps));
+    }
+    return multigridDict;
+}
+
 void updateSolver(NeoN::Dictionary& solverDict)
 {
     // Map OpenFOAM solver names to NeoN/Ginkgo solver names and types
@@ -33,39 +212,96 @@ void updateSolver(NeoN::Dictionary& solverDict)
     {
         std::cout << __FILE__ << ":\n\treplacing solver " << solverName << " by "
                   << it->second.second << "\n";
+        if (solverName == "GAMG")
+        {
+            auto multigridDict = mapGAMG(solverDict);
+            for (const auto& key : multigridDict.keys())
+            {
+                solverDict.insert(key, multigridDict[key]);
+            }
+            removeGAMGControls(solverDict);
+        }
         solverName = it->second.first;
-        // if (solverName == "GAMG")
-        // {
-        //     throw std::runtime_error(
-        //         "GAMG is not supported in FoamAdapter, please use a different solver."
-        //     );
-        // }
         solverDict.insert("type", it->second.second);
     }
 }
 
+NeoN::Dictionary
+mapPreconditioner(const std::string& preconditionerName, const NeoN::Dictionary& controls)
+{
+    if (preconditionerName == "DIC")
+    {
+        // incomplete Cholesky, the factors are computed by fixed point sweeps. It needs a positive
+        // diagonal, the PDESolver negates negative definite systems like the pressure equation
+        NeoN::Dictionary factorization(
+            {{std::string("type"), std::string("factorization::ParIc")}}
+        );
+        if (controls.contains("nSweeps"))
+        {
+            factorization.insert(
+                "iterations",
+                static_cast<int>(readIndex(controls, "nSweeps", 0))
+            );
+        }
+        return NeoN::Dictionary(
+            {{std::string("type"), std::string("preconditioner::Ic")},
+             {std::string("factorization"), factorization}}
+        );
+    }
+    if (preconditionerName == "DILU")
+    {
+        return NeoN::Dictionary(
+            {{std::string("type"), std::string("preconditioner::Ilu")},
+             {std::string("reverse_apply"), false},
+             {std::string("factorization"),
+              NeoN::Dictionary({{std::string("type"), std::string("factorization::ParIlu")}})}}
+        );
+    }
+    if (preconditionerName == "diagonal")
+    {
+        return NeoN::Dictionary(
+            {{std::string("type"), std::string("preconditioner::Jacobi")},
+             {std::string("max_block_size"), 1}}
+        );
+    }
+    if (preconditionerName == "blockJacobi")
+    {
+        // the blocks are detected from consecutive rows with a matching sparsity pattern, hence
+        // the block sizes depend on the cell numbering, eg. after renumberMesh
+        const auto maxBlockSize =
+            std::min<NeoN::localIdx>(readIndex(controls, "maxBlockSize", 8), 32);
+        return NeoN::Dictionary(
+            {{std::string("type"), std::string("preconditioner::Jacobi")},
+             {std::string("max_block_size"), static_cast<int>(maxBlockSize)}}
+        );
+    }
+    if (preconditionerName == "GAMG")
+    {
+        return gamgPreconditioner(controls);
+    }
+    throw std::runtime_error(
+        "Preconditioner " + preconditionerName + " is not supported in FoamAdapter"
+    );
+}
+
 void updatePreconditioner(NeoN::Dictionary& solverDict)
 {
-    // Map OpenFOAM preconditioner types to NeoN/Ginkgo preconditioner types
-    static std::map<std::string, NeoN::Dictionary> preconditionerMap = {
-        {"DIC",
-         NeoN::Dictionary(
-             {{std::string("type"), std::string("preconditioner::Jacobi")},
-              {std::string("max_block_size"), 1}}
-         )},
-        {"DILU",
-         NeoN::Dictionary(
-             {{std::string("type"), std::string("preconditioner::Ilu")},
-              {std::string("reverse_apply"), false},
-              {std::string("factorization"),
-               NeoN::Dictionary({{std::string("type"), std::string("factorization::ParIlu")}})}}
-         )},
+    // OpenFOAM preconditioners with a NeoN/Ginkgo counterpart
+    static const std::vector<std::string> supportedPreconditioners = {
+        "DIC", "DILU", "diagonal", "blockJacobi", "GAMG"
     };
 
+    // the multigrid solver applies its smoothers itself
+    if (solverDict.contains("type")
+        && solverDict.get<std::string>("type") == "solver::Multigrid")
+    {
+        return;
+    }
+
     // if no preconditioner is set but smoother switch to BiCGStab with BJ
     if (!solverDict.contains("preconditioner"))
     {
-        solverDict.insert("preconditioner", preconditionerMap["DIC"]);
+        solverDict.insert("preconditioner", mapPreconditioner("diagonal", NeoN::Dictionary()));
     }
     if (solverDict.contains("smoother"))
     {
@@ -75,30 +311,31 @@ void updatePreconditioner(NeoN::Dictionary& solverDict)
     if (solverDict.isDict("preconditioner"))
     {
         NeoN::Dictionary& preconditionerDict = solverDict.subDict("preconditioner");
-        if (preconditionerDict.isDict("type"))
+        // OpenFOAM preconditioner sub dictionary, eg. { preconditioner DIC; nSweeps 3; }
+        if (preconditionerDict.contains("preconditioner"))
         {
-            throw std::runtime_error(
-                "GAMG is not supported in FoamAdapter, please use a different preconditioner."
-            );
-            // std::string& preconditionerType = preconditionerDict.get<std::string>("type");
-            // auto it = preconditionerMap.find(preconditionerType);
-            // if (it != preconditionerMap.end())
-            // {
-            //     std::cout << __FILE__ << " replacing preconditioner " << preconditionerType << "
-            //     by " << it->second << "\n"; preconditionerType = it->second;
-            // }
+            const auto preconditionerName = preconditionerDict.get<std::string>("preconditioner");
+            auto mapped = mapPreconditioner(preconditionerName, preconditionerDict);
+            std::cout << __FILE__ << ":\n\treplacing preconditioner " << preconditionerName
+                      << " by " << mapped << "\n";
+            solverDict.insert("preconditioner", mapped);
         }
     }
     else
     {
         // If no preconditioner is specified, we can insert a default one
         std::string& preconditionerName = solverDict.get<std::string>("preconditioner");
-        auto it = preconditionerMap.find(preconditionerName);
-        if (it != preconditionerMap.end())
+        if (std::find(
+                supportedPreconditioners.begin(),
+                supportedPreconditioners.end(),
+                preconditionerName
+            )
+            != supportedPreconditioners.end())
         {
+            auto mapped = mapPreconditioner(preconditionerName, NeoN::Dictionary());
             std::cout << __FILE__ << ":\n\treplacing preconditioner " << preconditionerName
-                      << " by " << it->second << "\n";
-            solverDict.insert("preconditioner", it->second);
+                      << " by " << mapped << "\n";
+            solverDict.insert("preconditioner", mapped);
         }
     }
 }
@@ -142,6 +379,97 @@ void updateCriteria(NeoN::Dictionary& solverDict)
 }
 
 
+bool readSwitch(const NeoN::Dictionary& dict, const std::string& key, bool defaultValue)
+{
+    if (!dict.contains(key))
+    {
+        return defaultValue;
+    }
+    try
+    {
+        return dict.get<bool>(key);
+    }
+    catch (const std::bad_any_cast&)
+    {
+        static const std::map<std::string, bool> switchMap = {
+            {"yes", true},
+            {"on", true},
+            {"true", true},
+            {"y", true},
+            {"no", false},
+            {"off", false},
+            {"false", false},
+            {"n", false},
+            {"none", false},
+        };
+        const auto& value = dict.get<std::string>(key);
+        auto it = switchMap.find(value);
+        if (it == switchMap.end())
+        {
+            throw std::runtime_error("Invalid value " + value + " for switch " + key);
+        }
+        return it->second;
+    }
+}
+
+NeoN::localIdx
+readIndex(const NeoN::Dictionary& dict, const std::string& key, NeoN::localIdx defaultValue)
+{
+    if (!dict.contains(key))
+    {
+        return defaultValue;
+    }
+    try
+    {
+        return static_cast<NeoN::localIdx>(dict.get<int>(key));
+    }
+    catch (const std::bad_any_cast&)
+    {
+        return static_cast<NeoN::localIdx>(dict.get<NeoN::label>(key));
+    }
+}
+
+bool containsType(const NeoN::Dictionary& solverDict, const std::string& type)
+{
+    for (const auto& key : solverDict.keys())
+    {
+        if (solverDict.isDict(key))
+        {
+            if (containsType(solverDict.get<NeoN::Dictionary>(key), type)) return true;
+        }
+        else if (key == "type" && solverDict.get<std::string>(key) == type)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+NeoN::Dictionary removeAdapterControls(const NeoN::Dictionary& solverDict)
+{
+    // controls evaluated by FoamAdapter before the solver is called
+    static const std::vector<std::string> adapterControls = {
+        "batched",
+        "isotropic",
+        "initialGuess",
+        "nProjectionVectors",
+        "mixedPrecision",
+        "innerRelTol",
+        "maxInnerIter",
+        "maxCouplingIter",
+    };
+
+    NeoN::Dictionary result = solverDict;
+    for (const auto& key : adapterControls)
+    {
+        if (result.contains(key))
+        {
+            result.remove(key);
+        }
+    }
+    return result;
+}
+
 NeoN::Dictionary mapFvSolution(const NeoN::Dictionary& solverDict)
 {
     NeoN::Dictionary modSolverDict = solverDict;
@@ -1,7 +1,15 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 // SPDX-FileCopyrightText: 2023 FoamAdapter authors
 
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include "FoamAdapter/datastructures/meshAdapter.hpp"
+#include "FoamAdapter/auxiliary/firstTouch.hpp"
+#include "FoamAdapter/auxiliary/memoryReport.hpp"
+#include "FoamAdapter/auxiliary/timing.hpp"
 
 // * * * * * * * * * * * * * * Static Data Members * * * * * * * * * * * * * //
 
@@ -58,6 +66,7 @@ int32_t computeNBoundaryFaces(const Foam::fvMesh& mesh)
 
 NeoN::UnstructuredMesh readOpenFOAMMesh(const NeoN::Executor exec, const Foam::fvMesh& mesh)
 {
+    ScopedTimer timer("readOpenFOAMMesh");
     const int32_t nCells = mesh.nCells();
     const int32_t nInternalFaces = mesh.nInternalFaces();
     const int32_t nBoundaryFaces = computeNBoundaryFaces(mesh);
@@ -132,12 +141,41 @@ NeoN::UnstructuredMesh readOpenFOAMMesh(const NeoN::Executor exec, const Foam::f
         bMesh
     );
 
+    trackMemory(uMesh);
     return uMesh;
 }
 
+Connectivity readConnectivity(const NeoN::Executor exec, const Foam::fvMesh& mesh)
+{
+    ScopedTimer timer("readConnectivity");
+    if (mesh.nFaces() > std::numeric_limits<connectivityIdx>::max())
+    {
+        Foam::FatalError << "the " << mesh.nFaces() << " faces of the mesh exceed the range of "
+                         << "32 bit indices, reconfigure with -DFOAMADAPTER_COMPACT_INDEX=OFF"
+                         << Foam::nl
+                         << Foam::abort(Foam::FatalError);
+    }
+
+    const auto toConnectivityIdx = [exec](const Foam::labelUList& labels)
+    {
+        std::vector<connectivityIdx> indices(labels.begin(), labels.end());
+        return firstTouchVector(exec, indices.data(), indices.size());
+    };
+    Foam::labelList faceCells = flatBCField<Foam::labelList>(
+        mesh,
+        [](const Foam::fvPatch& patch) { return patch.faceCells(); }
+    );
+    return Connectivity {
+        .faceOwner = toConnectivityIdx(mesh.faceOwner()),
+        .faceNeighbour = toConnectivityIdx(mesh.faceNeighbour()),
+        .faceCells = toConnectivityIdx(faceCells)
+    };
+}
+
 MeshAdapter::MeshAdapter(const NeoN::Executor exec, const Foam::IOobject& io, const bool doInit)
     : fvMesh(io, doInit)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
+    , processorInterfaces_(exec, *this)
 {
     if (doInit)
     {
@@ -154,6 +192,7 @@ MeshAdapter::MeshAdapter(
 )
     : fvMesh(io, Foam::zero {}, syncPar)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
+    , processorInterfaces_(exec, *this)
 {}
 
 
@@ -175,6 +214,7 @@ MeshAdapter::MeshAdapter(
         syncPar
     )
     , nfMesh_(readOpenFOAMMesh(exec, *this))
+    , processorInterfaces_(exec, *this)
 {}
 
 
@@ -188,6 +228,127 @@ MeshAdapter::MeshAdapter(
 )
     : fvMesh(io, std::move(points), std::move(faces), std::move(cells), syncPar)
     , nfMesh_(readOpenFOAMMesh(exec, *this))
+    , processorInterfaces_(exec, *this)
 {}
 
+const SoAFaceGeometry& MeshAdapter::soaFaceGeometry() const
+{
+    if (!soaFaceGeometry_)
+    {
+        const auto exec = nfMesh_.exec();
+        soaFaceGeometry_.emplace(SoAFaceGeometry {
+            .faceAreas = SoAVector(fromFoamField(exec, Sf().primitiveField())),
+            .weights = fromFoamField(exec, weights().primitiveField())
+        });
+        const auto& geometry = *soaFaceGeometry_;
+        auto& report = MemoryReport::instance();
+        if (report.enabled())
+        {
+            report.track(
+                "mesh",
+                "soaFaceGeometry",
+                3 * memoryUsage(geometry.faceAreas.x()) + memoryUsage(geometry.weights)
+            );
+        }
+    }
+    return *soaFaceGeometry_;
+}
+
+void MeshAdapter::setSinglePrecisionGeometry(bool singlePrecision)
+{
+    singlePrecisionGeometry_ = singlePrecision;
+    auto& report = MemoryReport::instance();
+    if (singlePrecision && soaFaceGeometry_)
+    {
+        soaFaceGeometry_.reset();
+        if (report.enabled()) report.untrack("mesh", "soaFaceGeometry");
+    }
+    if (!singlePrecision && singlePrecisionFaceGeometry_)
+    {
+        singlePrecisionFaceGeometry_.reset();
+        if (report.enabled()) report.untrack("mesh", "singlePrecisionFaceGeometry");
+    }
+}
+
+const SinglePrecisionFaceGeometry& MeshAdapter::singlePrecisionFaceGeometry() const
+{
+    if (!singlePrecisionFaceGeometry_)
+    {
+        ScopedTimer timer("singlePrecisionFaceGeometry");
+        const auto& sf = Sf().primitiveField();
+        const auto& w = weights().primitiveField();
+        std::vector<float> sfX(sf.size()), sfY(sf.size()), sfZ(sf.size()), weightsF(w.size());
+        forAll(sf, facei)
+        {
+            sfX[facei] = static_cast<float>(sf[facei].x());
+            sfY[facei] = static_cast<float>(sf[facei].y());
+            sfZ[facei] = static_cast<float>(sf[facei].z());
+            weightsF[facei] = static_cast<float>(w[facei]);
+        }
+
+        const auto exec = nfMesh_.exec();
+        singlePrecisionFaceGeometry_.emplace(SinglePrecisionFaceGeometry {
+            .sfX = firstTouchVector(exec, sfX.data(), sfX.size()),
+            .sfY = firstTouchVector(exec, sfY.data(), sfY.size()),
+            .sfZ = firstTouchVector(exec, sfZ.data(), sfZ.size()),
+            .weights = firstTouchVector(exec, weightsF.data(), weightsF.size())
+        });
+        const auto& geometry = *singlePrecisionFaceGeometry_;
+        auto& report = MemoryReport::instance();
+        if (report.enabled())
+        {
+            report.track(
+                "mesh",
+                "singlePrecisionFaceGeometry",
+                3 * memoryUsage(geometry.sfX) + memoryUsage(geometry.weights)
+            );
+        }
+    }
+    return *singlePrecisionFaceGeometry_;
+}
+
+const Connectivity& MeshAdapter::connectivity() const
+{
+    if (!connectivity_)
+    {
+        connectivity_.emplace(readConnectivity(nfMesh_.exec(), *this));
+        const auto& conn = *connectivity_;
+        auto& report = MemoryReport::instance();
+        if (report.enabled())
+        {
+            report.track(
+                "mesh",
+                "connectivity",
+                memoryUsage(conn.faceOwner) + memoryUsage(conn.faceNeighbour)
+                    + memoryUsage(conn.faceCells)
+            );
+        }
+    }
+    return *connectivity_;
+}
+
+std::shared_ptr<const NeoN::Vector<connectivityIdx>>
+MeshAdapter::compactColIdxs(const NeoN::la::SparsityPattern& pattern) const
+{
+    const auto& colIdxs = pattern.colIdxs();
+    if (compactColIdxs_ && compactColIdxsSource_ == &colIdxs) return compactColIdxs_;
+
+    compactColIdxsSource_ = &colIdxs;
+    if constexpr (std::is_same_v<connectivityIdx, NeoN::localIdx>)
+    {
+        // a non owning pointer, the pattern outlives the systems
+        compactColIdxs_ = std::shared_ptr<const NeoN::Vector<connectivityIdx>>(
+            std::shared_ptr<const void> {},
+            &colIdxs
+        );
+    }
+    else
+    {
+        compactColIdxs_ = std::make_shared<const NeoN::Vector<connectivityIdx>>(
+            narrowIndices<connectivityIdx>(colIdxs)
+        );
+    }
+    return compactColIdxs_;
+}
+
 }
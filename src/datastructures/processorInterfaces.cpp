@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <map>
+
+#include "FoamAdapter/datastructures/processorInterfaces.hpp"
+
+#include "processorFvPatch.H"
+
+namespace FoamAdapter
+{
+
+ProcessorInterfaces::ProcessorInterfaces(const NeoN::Executor& exec, const Foam::fvMesh& mesh)
+    : sendCells_(exec, 0), receiveFaces_(exec, 0)
+{
+    std::vector<NeoN::localIdx> sendCells;
+    std::vector<NeoN::localIdx> receiveFaces;
+    // several patches may connect the same pair of ranks, their tags follow the patch order,
+    // which is the same on both sides
+    std::map<int, int> nPatchesPerNeighbour;
+
+    const Foam::fvBoundaryMesh& bMesh = mesh.boundary();
+    NeoN::localIdx start = 0;
+    forAll(bMesh, patchi)
+    {
+        const Foam::fvPatch& patch = bMesh[patchi];
+        if (const auto* procPatch = Foam::isA<Foam::processorFvPatch>(patch))
+        {
+            const int neighbourRank = procPatch->neighbProcNo();
+            interfaces_.push_back(
+                {.patchi = patchi,
+                 .neighbourRank = neighbourRank,
+                 .tag = nPatchesPerNeighbour[neighbourRank]++,
+                 .start = start,
+                 .size = static_cast<NeoN::localIdx>(patch.size()),
+                 .offset = static_cast<NeoN::localIdx>(sendCells.size())}
+            );
+            const Foam::labelUList& faceCells = patch.faceCells();
+            forAll(faceCells, facei)
+            {
+                sendCells.push_back(faceCells[facei]);
+                receiveFaces.push_back(start + facei);
+            }
+        }
+        start += patch.size();
+    }
+
+    sendCells_ = NeoN::Vector<NeoN::localIdx>(exec, sendCells.data(), sendCells.size());
+    receiveFaces_ = NeoN::Vector<NeoN::localIdx>(exec, receiveFaces.data(), receiveFaces.size());
+}
+
+bool ProcessorInterfaces::isProcessorPatch(NeoN::label patchi) const
+{
+    return std::any_of(
+        interfaces_.begin(),
+        interfaces_.end(),
+        [patchi](const auto& interface) { return interface.patchi == patchi; }
+    );
+}
+
+}
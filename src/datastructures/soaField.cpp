@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <utility>
+
+#include "FoamAdapter/datastructures/soaField.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+
+namespace FoamAdapter
+{
+
+using Vec3 = NeoN::Vec3;
+using scalar = NeoN::scalar;
+
+namespace
+{
+
+SoAVector takeFromPool(const NeoN::Executor& exec, std::size_t size)
+{
+    auto& pool = VectorPool<scalar>::instance();
+    auto x = pool.take(exec, size);
+    auto y = pool.take(exec, size);
+    auto z = pool.take(exec, size);
+    return SoAVector(std::move(x), std::move(y), std::move(z));
+}
+
+void giveToPool(SoAVector& vector)
+{
+    auto& pool = VectorPool<scalar>::instance();
+    pool.give(std::move(vector.x()));
+    pool.give(std::move(vector.y()));
+    pool.give(std::move(vector.z()));
+}
+
+}
+
+SoAVector::SoAVector(const NeoN::Executor& exec, std::size_t size)
+    : x_(exec, size), y_(exec, size), z_(exec, size)
+{}
+
+SoAVector::SoAVector(const NeoN::Vector<Vec3>& aos) : SoAVector(aos.exec(), aos.size())
+{
+    const auto in = aos.view();
+    auto [x, y, z] = views(x_, y_, z_);
+    NeoN::parallelFor(
+        aos.exec(),
+        {0, aos.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            x[i] = in[i][0];
+            y[i] = in[i][1];
+            z[i] = in[i][2];
+        }
+    );
+}
+
+SoAVector::SoAVector(
+    NeoN::Vector<scalar> x,
+    NeoN::Vector<scalar> y,
+    NeoN::Vector<scalar> z
+)
+    : x_(std::move(x)), y_(std::move(y)), z_(std::move(z))
+{
+    NF_ASSERT_EQUAL(x_.size(), y_.size());
+    NF_ASSERT_EQUAL(x_.size(), z_.size());
+}
+
+void SoAVector::fill(const Vec3& value)
+{
+    NeoN::fill(x_, value[0]);
+    NeoN::fill(y_, value[1]);
+    NeoN::fill(z_, value[2]);
+}
+
+void SoAVector::copyTo(NeoN::Vector<Vec3>& aos) const
+{
+    NF_ASSERT_EQUAL(aos.size(), size());
+    const auto [x, y, z] = views(x_, y_, z_);
+    aos.apply(KOKKOS_LAMBDA(const size_t i) { return Vec3(x[i], y[i], z[i]); });
+}
+
+NeoN::Vector<Vec3> SoAVector::toAoS() const
+{
+    NeoN::Vector<Vec3> aos(exec(), size());
+    copyTo(aos);
+    return aos;
+}
+
+SoAVector SoAVector::copyToHost() const
+{
+    return SoAVector(x_.copyToHost(), y_.copyToHost(), z_.copyToHost());
+}
+
+SoAVolumeField::SoAVolumeField(const NeoN::UnstructuredMesh& mesh, const std::string& name)
+    : name(name), mesh_(mesh), internal_(takeFromPool(mesh.exec(), mesh.nCells()))
+    , boundary_(takeFromPool(mesh.exec(), mesh.nBoundaryFaces())), pooled_(true)
+{}
+
+SoAVolumeField::SoAVolumeField(const fvcc::VolumeField<Vec3>& field)
+    : name(field.name), mesh_(field.mesh()), internal_(field.internalVector())
+    , boundary_(field.boundaryData().value())
+{}
+
+SoAVolumeField::~SoAVolumeField()
+{
+    if (!pooled_) return;
+    giveToPool(internal_);
+    giveToPool(boundary_);
+}
+
+void SoAVolumeField::copyTo(fvcc::VolumeField<Vec3>& field) const
+{
+    internal_.copyTo(field.internalVector());
+    boundary_.copyTo(field.boundaryData().value());
+}
+
+}
@@ -0,0 +1,345 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <cmath>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/linearAlgebra/batchedSolver.hpp"
+#include "FoamAdapter/auxiliary/solverTelemetry.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+
+namespace FoamAdapter
+{
+
+using Vec3 = NeoN::Vec3;
+using scalar = NeoN::scalar;
+using localIdx = NeoN::localIdx;
+
+namespace
+{
+
+KOKKOS_INLINE_FUNCTION Vec3 cmptMultiply(const Vec3& a, const Vec3& b)
+{
+    return Vec3(a[0] * b[0], a[1] * b[1], a[2] * b[2]);
+}
+
+/* @brief a scalar coefficient applies to all components, a Vec3 coefficient per component */
+KOKKOS_INLINE_FUNCTION Vec3 scale(const scalar a, const Vec3& b) { return a * b; }
+
+KOKKOS_INLINE_FUNCTION Vec3 scale(const Vec3& a, const Vec3& b) { return cmptMultiply(a, b); }
+
+/* @brief the inverse of a diagonal coefficient, a vanishing coefficient is not scaled */
+KOKKOS_INLINE_FUNCTION scalar inverse(const scalar a) { return (a != 0.0) ? 1.0 / a : 1.0; }
+
+KOKKOS_INLINE_FUNCTION Vec3 inverse(const Vec3& a)
+{
+    return Vec3(inverse(a[0]), inverse(a[1]), inverse(a[2]));
+}
+
+/* @brief component wise a / b, components with a vanishing denominator are set to zero */
+Vec3 cmptSafeDivide(const Vec3& a, const Vec3& b)
+{
+    Vec3 result(0.0, 0.0, 0.0);
+    for (int cmpt = 0; cmpt < 3; cmpt++)
+    {
+        result[cmpt] = (b[cmpt] != 0.0) ? a[cmpt] / b[cmpt] : 0.0;
+    }
+    return result;
+}
+
+scalar cmptMax(const Vec3& a) { return std::max({a[0], a[1], a[2]}); }
+
+/* @brief component wise dot product, ie. one reduction for all three right hand sides */
+Vec3 cmptDot(const NeoN::Vector<Vec3>& a, const NeoN::Vector<Vec3>& b)
+{
+    Vec3 result(0.0, 0.0, 0.0);
+    const auto [aView, bView] = views(a, b);
+    NeoN::parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const localIdx i, Vec3& sum) { sum += cmptMultiply(aView[i], bView[i]); },
+        result
+    );
+    return result;
+}
+
+Vec3 cmptNorm(const NeoN::Vector<Vec3>& a)
+{
+    auto sqr = cmptDot(a, a);
+    return Vec3(std::sqrt(sqr[0]), std::sqrt(sqr[1]), std::sqrt(sqr[2]));
+}
+
+/* @brief y = A x for scalar or per component coefficients */
+template<typename CoeffType, typename ColIdxType>
+void spmv(
+    const NeoN::Vector<CoeffType>& values,
+    const NeoN::Vector<ColIdxType>& colIdxs,
+    const NeoN::Vector<localIdx>& rowOffs,
+    const NeoN::Vector<Vec3>& x,
+    NeoN::Vector<Vec3>& y
+)
+{
+    const auto [valuesView, colView, rowView, xView] = views(values, colIdxs, rowOffs, x);
+    auto yView = y.view();
+    NeoN::parallelFor(
+        y.exec(),
+        {0, y.size()},
+        KOKKOS_LAMBDA(const size_t rowi) {
+            Vec3 sum(0.0, 0.0, 0.0);
+            for (auto j = rowView[rowi]; j < rowView[rowi + 1]; j++)
+            {
+                sum += scale(valuesView[j], xView[colView[j]]);
+            }
+            yView[rowi] = sum;
+        }
+    );
+}
+
+template<typename CoeffType, typename ColIdxType>
+NeoN::Vector<CoeffType> inverseDiagonal(
+    const NeoN::Vector<CoeffType>& values,
+    const NeoN::Vector<ColIdxType>& colIdxs,
+    const NeoN::Vector<localIdx>& rowOffs,
+    localIdx nRows
+)
+{
+    NeoN::Vector<CoeffType> invDiag(values.exec(), nRows);
+    const auto [valuesView, colView, rowView] = views(values, colIdxs, rowOffs);
+    invDiag.apply(KOKKOS_LAMBDA(const size_t rowi) {
+        for (auto j = rowView[rowi]; j < rowView[rowi + 1]; j++)
+        {
+            if (static_cast<size_t>(colView[j]) == rowi) return inverse(valuesView[j]);
+        }
+        return inverse(NeoN::zero<CoeffType>());
+    });
+    return invDiag;
+}
+
+/* @brief the batched solver for the coefficient and column index type of the system */
+template<typename CoeffType, typename ColIdxType>
+NeoN::la::SolverStats batchedSolveImpl(
+    const NeoN::Vector<CoeffType>& values,
+    const NeoN::Vector<ColIdxType>& colIdxs,
+    const NeoN::Vector<localIdx>& rowOffs,
+    const NeoN::Vector<Vec3>& rhs,
+    NeoN::Vector<Vec3>& x,
+    const SolverCriteria& criteria,
+    scalar* setupTime
+)
+{
+    const auto exec = x.exec();
+    const auto nRows = x.size();
+    const Vec3 zero(0.0, 0.0, 0.0);
+
+    Timer setupTimer;
+    const auto invDiag = inverseDiagonal(values, colIdxs, rowOffs, nRows);
+    if (setupTime) *setupTime = setupTimer.elapsed();
+
+    // r = b - A x
+    // the work vectors are drawn from the pool, consecutive solves of the same mesh reuse them
+    PooledVector<Vec3> r(exec, nRows, zero);
+    spmv(values, colIdxs, rowOffs, x, *r);
+    {
+        const auto bView = rhs.view();
+        auto rView = r->view();
+        r->apply(KOKKOS_LAMBDA(const size_t i) { return bView[i] - rView[i]; });
+    }
+
+    PooledVector<Vec3> rHat(exec, nRows);
+    *rHat = *r;
+    PooledVector<Vec3> p(exec, nRows, zero);
+    PooledVector<Vec3> v(exec, nRows, zero);
+    PooledVector<Vec3> pHat(exec, nRows, zero);
+    PooledVector<Vec3> s(exec, nRows, zero);
+    PooledVector<Vec3> sHat(exec, nRows, zero);
+    PooledVector<Vec3> t(exec, nRows, zero);
+
+    const auto [invDiagView, rHatView] = views(invDiag, *rHat);
+    auto [xView, rView, pView, vView, pHatView, sView, sHatView, tView] =
+        views(x, *r, *p, *v, *pHat, *s, *sHat, *t);
+
+    const Vec3 initResNorm = cmptNorm(*r);
+    Vec3 tol(0.0, 0.0, 0.0);
+    for (int cmpt = 0; cmpt < 3; cmpt++)
+    {
+        tol[cmpt] = std::max(criteria.absTol, criteria.relTol * initResNorm[cmpt]);
+    }
+
+    // a component is active until its residual drops below its tolerance
+    auto activeComponents = [&tol](const Vec3& resNorm)
+    {
+        Vec3 active(0.0, 0.0, 0.0);
+        for (int cmpt = 0; cmpt < 3; cmpt++)
+        {
+            active[cmpt] = (resNorm[cmpt] > tol[cmpt]) ? 1.0 : 0.0;
+        }
+        return active;
+    };
+
+    Vec3 resNorm = initResNorm;
+    Vec3 rho(1.0, 1.0, 1.0);
+    Vec3 alpha(1.0, 1.0, 1.0);
+    Vec3 omega(1.0, 1.0, 1.0);
+    localIdx iter = 0;
+
+    while (iter < criteria.maxIter)
+    {
+        const Vec3 active = activeComponents(resNorm);
+        if (cmptMax(active) == 0.0)
+        {
+            break;
+        }
+
+        const Vec3 rhoNew = cmptDot(*rHat, *r);
+        const Vec3 beta = cmptMultiply(cmptSafeDivide(rhoNew, rho), cmptSafeDivide(alpha, omega));
+
+        // p = r + beta (p - omega v), pHat = M^-1 p
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                pView[i] = rView[i] + cmptMultiply(beta, pView[i] - cmptMultiply(omega, vView[i]));
+                pHatView[i] = scale(invDiagView[i], pView[i]);
+            }
+        );
+        spmv(values, colIdxs, rowOffs, *pHat, *v);
+        alpha = cmptMultiply(active, cmptSafeDivide(rhoNew, cmptDot(*rHat, *v)));
+
+        // s = r - alpha v, sHat = M^-1 s
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                sView[i] = rView[i] - cmptMultiply(alpha, vView[i]);
+                sHatView[i] = scale(invDiagView[i], sView[i]);
+            }
+        );
+        spmv(values, colIdxs, rowOffs, *sHat, *t);
+        omega = cmptMultiply(active, cmptSafeDivide(cmptDot(*t, *s), cmptDot(*t, *t)));
+
+        // x += alpha pHat + omega sHat, r = s - omega t
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                xView[i] += cmptMultiply(alpha, pHatView[i]) + cmptMultiply(omega, sHatView[i]);
+                rView[i] = sView[i] - cmptMultiply(omega, tView[i]);
+            }
+        );
+
+        resNorm = cmptNorm(*r);
+        rho = rhoNew;
+        iter++;
+    }
+
+    NeoN::la::SolverStats stats {};
+    stats.numIter = iter;
+    stats.initResNorm = cmptMax(initResNorm);
+    stats.finalResNorm = cmptMax(resNorm);
+    return stats;
+}
+
+}
+
+bool isotropicCoefficients(const NeoN::la::LinearSystem<Vec3, localIdx>& ls)
+{
+    const auto values = ls.matrix().values().view();
+    scalar nAnisotropic = 0.0;
+    NeoN::parallelReduce(
+        ls.exec(),
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t i, scalar& sum) {
+            const auto& value = values[i];
+            sum += (value[0] == value[1] && value[0] == value[2]) ? 0.0 : 1.0;
+        },
+        nAnisotropic
+    );
+    return nAnisotropic == 0.0;
+}
+
+NeoN::Vector<scalar> scalarCoefficients(const NeoN::la::LinearSystem<Vec3, localIdx>& ls)
+{
+    const auto values = ls.matrix().values().view();
+    NeoN::Vector<scalar> result(ls.exec(), values.size());
+    result.apply(KOKKOS_LAMBDA(const size_t i) { return values[i][0]; });
+    return result;
+}
+
+NeoN::la::SolverStats batchedSolve(
+    const NeoN::Vector<scalar>& values,
+    const NeoN::Vector<localIdx>& colIdxs,
+    const NeoN::Vector<localIdx>& rowOffs,
+    const NeoN::Vector<Vec3>& rhs,
+    NeoN::Vector<Vec3>& x,
+    const SolverCriteria& criteria,
+    scalar* setupTime
+)
+{
+    return batchedSolveImpl(values, colIdxs, rowOffs, rhs, x, criteria, setupTime);
+}
+
+NeoN::la::SolverStats batchedSolve(
+    const NeoN::la::LinearSystem<Vec3, localIdx>& ls,
+    NeoN::Vector<Vec3>& x,
+    const NeoN::Dictionary& solverDict,
+    scalar* setupTime
+)
+{
+    requireSupportedSettings(solverDict, "batched solver");
+    const auto criteria = SolverCriteria::read(solverDict);
+    const auto& matrix = ls.matrix();
+    Timer coefficientTimer;
+    if (!isotropicCoefficients(ls))
+    {
+        // eg. the diagonal of a symmetry or slip boundary, the components are solved with their
+        // own coefficients
+        const scalar checkTime = setupTime ? coefficientTimer.elapsed() : 0.0;
+        auto stats = batchedSolveImpl(
+            matrix.values(),
+            matrix.colIdxs(),
+            matrix.rowOffs(),
+            ls.rhs(),
+            x,
+            criteria,
+            setupTime
+        );
+        if (setupTime) *setupTime += checkTime;
+        return stats;
+    }
+    const auto values = scalarCoefficients(ls);
+    const scalar coefficientTime = setupTime ? coefficientTimer.elapsed() : 0.0;
+    auto stats = batchedSolve(
+        values,
+        matrix.colIdxs(),
+        matrix.rowOffs(),
+        ls.rhs(),
+        x,
+        criteria,
+        setupTime
+    );
+    if (setupTime) *setupTime += coefficientTime;
+    return stats;
+}
+
+NeoN::la::SolverStats batchedSolve(
+    const IsotropicLinearSystem<localIdx>& ls,
+    NeoN::Vector<Vec3>& x,
+    const NeoN::Dictionary& solverDict,
+    scalar* setupTime
+)
+{
+    requireSupportedSettings(solverDict, "batched solver");
+    return batchedSolveImpl(
+        ls.values(),
+        ls.colIdxs(),
+        ls.rowOffs(),
+        ls.rhs(),
+        x,
+        SolverCriteria::read(solverDict),
+        setupTime
+    );
+}
+
+}
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+
+#include "PstreamReduceOps.H"
+#include "scalarField.H"
+
+#include "FoamAdapter/linearAlgebra/initialGuess.hpp"
+#include "FoamAdapter/compatibility/fvSolution.hpp"
+
+namespace FoamAdapter
+{
+
+using scalar = NeoN::scalar;
+using localIdx = NeoN::localIdx;
+
+namespace
+{
+
+/* @brief the dot product of the local values of a decomposed vector */
+scalar localDot(const NeoN::Vector<scalar>& a, const NeoN::Vector<scalar>& b)
+{
+    scalar result = 0.0;
+    const auto [aView, bView] = views(a, b);
+    NeoN::parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& sum) { sum += aView[i] * bView[i]; },
+        result
+    );
+    return result;
+}
+
+/* @brief the L2 norm over all ranks, all ranks thus take the same decision on the guess */
+scalar norm(const NeoN::Vector<scalar>& a)
+{
+    return std::sqrt(Foam::returnReduce(localDot(a, a), Foam::sumOp<Foam::scalar>()));
+}
+
+/* @brief solves the small dense system G c = h by Gaussian elimination with partial pivoting
+ *
+ * @details the Gram matrix of nearly linearly dependent vectors is close to singular, a small
+ * diagonal shift keeps the elimination stable, the resulting coefficients still yield a valid
+ * guess since the guess is checked against the residual of the current solution
+ */
+std::vector<scalar> solveNormalEquations(std::vector<std::vector<scalar>> G, std::vector<scalar> h)
+{
+    const auto n = h.size();
+    scalar maxDiag = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        maxDiag = std::max(maxDiag, G[i][i]);
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        G[i][i] += 1e-12 * maxDiag;
+    }
+
+    for (size_t col = 0; col < n; col++)
+    {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < n; row++)
+        {
+            if (std::abs(G[row][col]) > std::abs(G[pivot][col])) pivot = row;
+        }
+        std::swap(G[col], G[pivot]);
+        std::swap(h[col], h[pivot]);
+        if (G[col][col] == 0.0) continue;
+        for (size_t row = col + 1; row < n; row++)
+        {
+            const scalar factor = G[row][col] / G[col][col];
+            for (size_t k = col; k < n; k++)
+            {
+                G[row][k] -= factor * G[col][k];
+            }
+            h[row] -= factor * h[col];
+        }
+    }
+
+    std::vector<scalar> c(n, 0.0);
+    for (size_t row = n; row-- > 0;)
+    {
+        if (G[row][row] == 0.0) continue;
+        scalar sum = h[row];
+        for (size_t k = row + 1; k < n; k++)
+        {
+            sum -= G[row][k] * c[k];
+        }
+        c[row] = sum / G[row][row];
+    }
+    return c;
+}
+
+}
+
+InitialGuessControls InitialGuessControls::read(const NeoN::Dictionary& fieldSolverDict)
+{
+    static const std::map<std::string, InitialGuessType> typeMap = {
+        {"previous", InitialGuessType::previous},
+        {"extrapolate", InitialGuessType::extrapolate},
+        {"projection", InitialGuessType::projection},
+    };
+
+    InitialGuessControls controls {};
+    if (fieldSolverDict.contains("initialGuess"))
+    {
+        const auto& typeName = fieldSolverDict.get<std::string>("initialGuess");
+        auto it = typeMap.find(typeName);
+        if (it == typeMap.end())
+        {
+            throw std::runtime_error(
+                "Invalid initialGuess " + typeName + ", valid are previous, extrapolate, projection"
+            );
+        }
+        controls.type = it->second;
+    }
+    controls.nProjectionVectors =
+        readIndex(fieldSolverDict, "nProjectionVectors", controls.nProjectionVectors);
+    if (controls.nProjectionVectors < 1)
+    {
+        throw std::runtime_error("nProjectionVectors has to be at least 1");
+    }
+    return controls;
+}
+
+std::string name(InitialGuessType type)
+{
+    switch (type)
+    {
+    case InitialGuessType::extrapolate:
+        return "extrapolate";
+    case InitialGuessType::projection:
+        return "projection";
+    default:
+        return "previous";
+    }
+}
+
+scalar InitialGuessStats::residualRatio() const
+{
+    return (previousResNorm > 0.0) ? guessResNorm / previousResNorm : 1.0;
+}
+
+scalar InitialGuessStats::iterationsSaved(const NeoN::la::SolverStats& stats) const
+{
+    if (stats.numIter == 0 || stats.finalResNorm <= 0.0 || stats.finalResNorm >= stats.initResNorm
+        || guessResNorm <= 0.0 || guessResNorm >= previousResNorm)
+    {
+        return 0.0;
+    }
+    // average reduction of the log residual per iteration
+    const scalar rate = std::log(stats.initResNorm / stats.finalResNorm) / stats.numIter;
+    return std::log(previousResNorm / guessResNorm) / rate;
+}
+
+InitialGuessStats InitialGuess::apply(
+    const InitialGuessControls& controls,
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    scalar t,
+    NeoN::Vector<scalar>& x
+) const
+{
+    NeoN::Vector<scalar> res(x.exec(), x.size(), 0.0);
+    NeoN::la::computeResidual(ls.matrix(), ls.rhs(), x, res);
+
+    InitialGuessStats stats {};
+    stats.previousResNorm = norm(res);
+    stats.guessResNorm = stats.previousResNorm;
+
+    if (controls.type == InitialGuessType::previous)
+    {
+        return stats;
+    }
+
+    NeoN::Vector<scalar> guess(x);
+    if (controls.type == InitialGuessType::extrapolate)
+    {
+        extrapolate(t, guess);
+    }
+    else
+    {
+        project(ls, guess);
+    }
+
+    NeoN::la::computeResidual(ls.matrix(), ls.rhs(), guess, res);
+    const scalar guessResNorm = norm(res);
+    if (guessResNorm < stats.previousResNorm)
+    {
+        x = guess;
+        stats.guessResNorm = guessResNorm;
+    }
+    return stats;
+}
+
+void InitialGuess::store(
+    const InitialGuessControls& controls,
+    scalar t,
+    const NeoN::Vector<scalar>& x
+)
+{
+    if (controls.type == InitialGuessType::extrapolate)
+    {
+        // the last solve of a time step overwrites the solutions of the previous correctors
+        if (timeLevels_.empty() || t > timeLevels_.back().first)
+        {
+            timeLevels_.emplace_back(t, x);
+        }
+        else
+        {
+            timeLevels_.back().second = x;
+        }
+        while (timeLevels_.size() > 2)
+        {
+            timeLevels_.pop_front();
+        }
+    }
+    if (controls.type == InitialGuessType::projection)
+    {
+        subspace_.push_back(x);
+        while (subspace_.size() > static_cast<size_t>(controls.nProjectionVectors))
+        {
+            subspace_.pop_front();
+        }
+    }
+}
+
+void InitialGuess::extrapolate(scalar t, NeoN::Vector<scalar>& x) const
+{
+    // extrapolation is only meaningful for the first solve of a new time step
+    if (timeLevels_.size() < 2 || t <= timeLevels_.back().first)
+    {
+        return;
+    }
+    const auto t0 = timeLevels_.front().first;
+    const auto t1 = timeLevels_.back().first;
+    const scalar factor = (t - t1) / (t1 - t0);
+    const auto [x0, x1] = views(timeLevels_.front().second, timeLevels_.back().second);
+    x.apply(KOKKOS_LAMBDA(const size_t celli) {
+        return x1[celli] + factor * (x1[celli] - x0[celli]);
+    });
+}
+
+void InitialGuess::project(
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    NeoN::Vector<scalar>& x
+) const
+{
+    const auto k = subspace_.size();
+    if (k == 0)
+    {
+        return;
+    }
+
+    // images of the subspace vectors, A x_j = b - r_j
+    std::vector<NeoN::Vector<scalar>> images;
+    images.reserve(k);
+    const auto rhs = ls.rhs().view();
+    for (const auto& xj : subspace_)
+    {
+        NeoN::Vector<scalar> image(x.exec(), x.size(), 0.0);
+        NeoN::la::computeResidual(ls.matrix(), ls.rhs(), xj, image);
+        auto imageView = image.view();
+        image.apply(KOKKOS_LAMBDA(const size_t i) { return rhs[i] - imageView[i]; });
+        images.push_back(std::move(image));
+    }
+
+    // minimize |b - sum_j c_j A x_j| via the normal equations, the dot products of all ranks are
+    // summed by one reduction so every rank solves the same system for the same coefficients
+    Foam::scalarField products(k * (k + 1) / 2 + k, 0.0);
+    Foam::label producti = 0;
+    for (size_t i = 0; i < k; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            products[producti++] = localDot(images[i], images[j]);
+        }
+        products[producti++] = localDot(images[i], ls.rhs());
+    }
+    Foam::reduce(products, Foam::sumOp<Foam::scalarField>());
+
+    std::vector<std::vector<scalar>> G(k, std::vector<scalar>(k, 0.0));
+    std::vector<scalar> h(k, 0.0);
+    producti = 0;
+    for (size_t i = 0; i < k; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            G[i][j] = products[producti++];
+            G[j][i] = G[i][j];
+        }
+        h[i] = products[producti++];
+    }
+    const auto c = solveNormalEquations(G, h);
+
+    NeoN::fill(x, 0.0);
+    auto xView = x.view();
+    for (size_t j = 0; j < k; j++)
+    {
+        const auto xj = subspace_[j].view();
+        const auto cj = c[j];
+        NeoN::parallelFor(
+            x.exec(),
+            {0, x.size()},
+            KOKKOS_LAMBDA(const size_t i) { xView[i] += cj * xj[i]; }
+        );
+    }
+}
+
+}
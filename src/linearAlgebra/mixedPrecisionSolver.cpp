@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "NeoN/NeoN.hpp"
+
+#include "FoamAdapter/linearAlgebra/mixedPrecisionSolver.hpp"
+#include "FoamAdapter/auxiliary/vectorPool.hpp"
+#include "FoamAdapter/compatibility/fvSolution.hpp"
+#include "FoamAdapter/datastructures/connectivity.hpp"
+
+namespace FoamAdapter
+{
+
+using scalar = NeoN::scalar;
+using localIdx = NeoN::localIdx;
+
+namespace
+{
+
+void spmv(
+    const SinglePrecisionMatrix& matrix,
+    const NeoN::Vector<float>& x,
+    NeoN::Vector<float>& y
+)
+{
+    const auto [values, colView, rowView, xView] =
+        views(matrix.values(), matrix.colIdxs(), matrix.rowOffs(), x);
+    auto yView = y.view();
+    NeoN::parallelFor(
+        y.exec(),
+        {0, y.size()},
+        KOKKOS_LAMBDA(const size_t rowi) {
+            float sum = 0.0f;
+            for (auto j = rowView[rowi]; j < rowView[rowi + 1]; j++)
+            {
+                sum += values[j] * xView[colView[j]];
+            }
+            yView[rowi] = sum;
+        }
+    );
+}
+
+/* @brief dot product, float vectors are accumulated in double precision */
+template<typename ValueType>
+scalar dot(const NeoN::Vector<ValueType>& a, const NeoN::Vector<ValueType>& b)
+{
+    scalar result = 0.0;
+    const auto [aView, bView] = views(a, b);
+    NeoN::parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& sum) {
+            sum += static_cast<scalar>(aView[i]) * static_cast<scalar>(bView[i]);
+        },
+        result
+    );
+    return result;
+}
+
+template<typename ValueType>
+scalar norm(const NeoN::Vector<ValueType>& a)
+{
+    return std::sqrt(dot(a, a));
+}
+
+scalar safeDivide(scalar a, scalar b) { return (b != 0.0) ? a / b : 0.0; }
+
+/* @brief approximately solves A d = r in single precision, d is zero on entry
+ * @return the number of iterations
+ */
+localIdx innerSolve(
+    const SinglePrecisionMatrix& matrix,
+    const NeoN::Vector<float>& r0,
+    NeoN::Vector<float>& d,
+    scalar relTol,
+    localIdx maxIter
+)
+{
+    const auto exec = d.exec();
+    const auto nRows = d.size();
+
+    // each outer iteration calls the inner solver, the work vectors are reused from the pool
+    PooledVector<float> r(exec, nRows);
+    *r = r0;
+    PooledVector<float> p(exec, nRows, 0.0f);
+    PooledVector<float> v(exec, nRows, 0.0f);
+    PooledVector<float> pHat(exec, nRows, 0.0f);
+    PooledVector<float> s(exec, nRows, 0.0f);
+    PooledVector<float> sHat(exec, nRows, 0.0f);
+    PooledVector<float> t(exec, nRows, 0.0f);
+
+    const auto invDiagView = matrix.invDiag().view();
+    auto [dView, rView, pView, vView, pHatView, sView, sHatView, tView] =
+        views(d, *r, *p, *v, *pHat, *s, *sHat, *t);
+
+    const scalar tol = relTol * norm(r0);
+    scalar resNorm = norm(r0);
+    scalar rho = 1.0;
+    scalar alpha = 1.0;
+    scalar omega = 1.0;
+    localIdx iter = 0;
+
+    while (iter < maxIter && resNorm > tol)
+    {
+        const scalar rhoNew = dot(r0, *r);
+        const auto beta = static_cast<float>(safeDivide(rhoNew, rho) * safeDivide(alpha, omega));
+        const auto omegaF = static_cast<float>(omega);
+
+        // p = r + beta (p - omega v), pHat = M^-1 p
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                pView[i] = rView[i] + beta * (pView[i] - omegaF * vView[i]);
+                pHatView[i] = invDiagView[i] * pView[i];
+            }
+        );
+        spmv(matrix, *pHat, *v);
+        alpha = safeDivide(rhoNew, dot(r0, *v));
+        const auto alphaF = static_cast<float>(alpha);
+
+        // s = r - alpha v, sHat = M^-1 s
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                sView[i] = rView[i] - alphaF * vView[i];
+                sHatView[i] = invDiagView[i] * sView[i];
+            }
+        );
+        spmv(matrix, *sHat, *t);
+        omega = safeDivide(dot(*t, *s), dot(*t, *t));
+        const auto omegaNewF = static_cast<float>(omega);
+
+        // d += alpha pHat + omega sHat, r = s - omega t
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) {
+                dView[i] += alphaF * pHatView[i] + omegaNewF * sHatView[i];
+                rView[i] = sView[i] - omegaNewF * tView[i];
+            }
+        );
+
+        resNorm = norm(*r);
+        rho = rhoNew;
+        iter++;
+
+        // breakdown of the recurrences, the outer iteration restarts from the true residual
+        if (rho == 0.0 || omega == 0.0) break;
+    }
+    return iter;
+}
+
+}
+
+void SinglePrecisionMatrix::update(
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    const NeoN::la::SparsityPattern& pattern,
+    std::shared_ptr<const NeoN::Vector<connectivityIdx>> colIdxs
+)
+{
+    const auto& matrix = ls.matrix();
+    if (pattern_ != &pattern || !values_)
+    {
+        pattern_ = &pattern;
+        colIdxs_ = colIdxs ? std::move(colIdxs)
+                           : std::make_shared<const NeoN::Vector<connectivityIdx>>(
+                                 narrowIndices<connectivityIdx>(pattern.colIdxs())
+                             );
+        values_.emplace(ls.exec(), matrix.values().size());
+        invDiag_.emplace(ls.exec(), pattern.diagOffset().size());
+    }
+
+    const auto [values, rowOffs, diagOffset] =
+        views(matrix.values(), pattern.rowOffs(), pattern.diagOffset());
+    values_->apply(KOKKOS_LAMBDA(const size_t i) { return static_cast<float>(values[i]); });
+    invDiag_->apply(KOKKOS_LAMBDA(const size_t rowi) {
+        const auto diag = values[rowOffs[rowi] + diagOffset[rowi]];
+        return (diag != 0.0) ? static_cast<float>(1.0 / diag) : 1.0f;
+    });
+}
+
+MixedPrecisionControls MixedPrecisionControls::read(const NeoN::Dictionary& fieldSolverDict)
+{
+    MixedPrecisionControls controls {};
+    if (fieldSolverDict.contains("innerRelTol"))
+    {
+        controls.innerRelTol = fieldSolverDict.get<scalar>("innerRelTol");
+    }
+    controls.maxInnerIter = readIndex(fieldSolverDict, "maxInnerIter", controls.maxInnerIter);
+    return controls;
+}
+
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    NeoN::Vector<scalar>& x,
+    const SolverCriteria& criteria,
+    const MixedPrecisionControls& controls,
+    const SinglePrecisionMatrix& matrix
+)
+{
+    const auto exec = x.exec();
+    const auto nRows = x.size();
+    PooledVector<scalar> res(exec, nRows, 0.0);
+    PooledVector<float> resF(exec, nRows, 0.0f);
+    PooledVector<float> correction(exec, nRows, 0.0f);
+
+    NeoN::la::computeResidual(ls.matrix(), ls.rhs(), x, *res);
+    const scalar initResNorm = norm(*res);
+    const scalar tol = std::max(criteria.absTol, criteria.relTol * initResNorm);
+
+    scalar resNorm = initResNorm;
+    localIdx iter = 0;
+    while (resNorm > tol && iter < criteria.maxIter)
+    {
+        const auto resView = res->view();
+        resF->apply(KOKKOS_LAMBDA(const size_t i) { return static_cast<float>(resView[i]); });
+        NeoN::fill(*correction, 0.0f);
+
+        // do not ask the inner solver for more than the remaining reduction
+        const scalar innerRelTol = std::max(controls.innerRelTol, tol / resNorm);
+        iter += innerSolve(
+            matrix,
+            *resF,
+            *correction,
+            innerRelTol,
+            std::min(controls.maxInnerIter, criteria.maxIter - iter)
+        );
+
+        const auto correctionView = correction->view();
+        auto xView = x.view();
+        NeoN::parallelFor(
+            exec,
+            {0, nRows},
+            KOKKOS_LAMBDA(const size_t i) { xView[i] += static_cast<scalar>(correctionView[i]); }
+        );
+
+        NeoN::la::computeResidual(ls.matrix(), ls.rhs(), x, *res);
+        const scalar newResNorm = norm(*res);
+        if (newResNorm >= resNorm)
+        {
+            // the single precision correction does not reduce the residual any further,
+            // revert it and keep the last solution
+            NeoN::parallelFor(
+                exec,
+                {0, nRows},
+                KOKKOS_LAMBDA(const size_t i) {
+                    xView[i] -= static_cast<scalar>(correctionView[i]);
+                }
+            );
+            break;
+        }
+        resNorm = newResNorm;
+    }
+
+    NeoN::la::SolverStats stats {};
+    stats.numIter = iter;
+    stats.initResNorm = initResNorm;
+    stats.finalResNorm = resNorm;
+    return stats;
+}
+
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    const NeoN::la::SparsityPattern& pattern,
+    NeoN::Vector<scalar>& x,
+    const SolverCriteria& criteria,
+    const MixedPrecisionControls& controls
+)
+{
+    SinglePrecisionMatrix matrix;
+    matrix.update(ls, pattern);
+    return mixedPrecisionSolve(ls, x, criteria, controls, matrix);
+}
+
+NeoN::la::SolverStats mixedPrecisionSolve(
+    const NeoN::la::LinearSystem<scalar, localIdx>& ls,
+    NeoN::Vector<scalar>& x,
+    const NeoN::Dictionary& solverDict,
+    const SinglePrecisionMatrix& matrix
+)
+{
+    requireSupportedSettings(solverDict, "mixed precision solver");
+    return mixedPrecisionSolve(
+        ls,
+        x,
+        SolverCriteria::read(solverDict),
+        MixedPrecisionControls::read(solverDict),
+        matrix
+    );
+}
+
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "FoamAdapter/linearAlgebra/solverCriteria.hpp"
+#include "FoamAdapter/compatibility/fvSolution.hpp"
+
+namespace FoamAdapter
+{
+
+namespace
+{
+
+/* @brief the solver name, ie. the mapped Ginkgo type or the OpenFOAM solver */
+std::string solverName(const NeoN::Dictionary& solverDict)
+{
+    if (solverDict.contains("type")) return solverDict.get<std::string>("type");
+    if (solverDict.contains("solver")) return solverDict.get<std::string>("solver");
+    return "";
+}
+
+/* @brief the preconditioner name, a block Jacobi is reported with its block size */
+std::string preconditionerName(const NeoN::Dictionary& solverDict)
+{
+    if (!solverDict.contains("preconditioner")) return "";
+    if (!solverDict.isDict("preconditioner"))
+    {
+        return solverDict.get<std::string>("preconditioner");
+    }
+    const auto& preconditionerDict = solverDict.get<NeoN::Dictionary>("preconditioner");
+    // OpenFOAM preconditioner sub dictionary, eg. { preconditioner DIC; }
+    if (preconditionerDict.contains("preconditioner"))
+    {
+        return preconditionerDict.get<std::string>("preconditioner");
+    }
+    if (!preconditionerDict.contains("type")) return "";
+    const auto name = preconditionerDict.get<std::string>("type");
+    const auto maxBlockSize = readIndex(preconditionerDict, "max_block_size", 1);
+    if (name == "preconditioner::Jacobi" && maxBlockSize > 1)
+    {
+        return name + " with max_block_size " + std::to_string(maxBlockSize);
+    }
+    return name;
+}
+
+/* @brief the settings that differ from a Jacobi preconditioned BiCGStab and their replacement */
+std::vector<std::pair<std::string, std::string>>
+unsupportedSettings(const NeoN::Dictionary& solverDict)
+{
+    // an unset solver or preconditioner selects the Jacobi preconditioned BiCGStab
+    static const std::set<std::string> bicgstab = {"", "solver::Bicgstab", "PBiCGStab"};
+    static const std::set<std::string> jacobi = {"", "diagonal", "preconditioner::Jacobi"};
+
+    if (solverDict.contains("configFile"))
+    {
+        return {{"the configFile", "a Jacobi preconditioned BiCGStab"}};
+    }
+    std::vector<std::pair<std::string, std::string>> unsupported;
+    const auto solverType = solverName(solverDict);
+    if (!bicgstab.contains(solverType))
+    {
+        unsupported.emplace_back("solver " + solverType, "BiCGStab");
+    }
+    const auto preconditioner = preconditionerName(solverDict);
+    if (!jacobi.contains(preconditioner))
+    {
+        unsupported.emplace_back("preconditioner " + preconditioner, "a diagonal preconditioner");
+    }
+    return unsupported;
+}
+
+}
+
+SolverCriteria SolverCriteria::read(const NeoN::Dictionary& solverDict)
+{
+    SolverCriteria criteria {};
+    if (!solverDict.contains("criteria"))
+    {
+        criteria.maxIter = readIndex(solverDict, "maxIter", criteria.maxIter);
+        if (solverDict.contains("tolerance"))
+        {
+            criteria.absTol = solverDict.get<NeoN::scalar>("tolerance");
+        }
+        if (solverDict.contains("relTol"))
+        {
+            criteria.relTol = solverDict.get<NeoN::scalar>("relTol");
+        }
+        return criteria;
+    }
+    const auto& criteriaDict = solverDict.get<NeoN::Dictionary>("criteria");
+    criteria.maxIter = readIndex(criteriaDict, "iteration", criteria.maxIter);
+    if (criteriaDict.contains("absolute_residual_norm"))
+    {
+        criteria.absTol = criteriaDict.get<NeoN::scalar>("absolute_residual_norm");
+    }
+    if (criteriaDict.contains("relative_residual_norm"))
+    {
+        criteria.relTol = criteriaDict.get<NeoN::scalar>("relative_residual_norm");
+    }
+    return criteria;
+}
+
+void requireSupportedSettings(const NeoN::Dictionary& solverDict, const std::string& solver)
+{
+    const auto unsupported = unsupportedSettings(solverDict);
+    if (unsupported.empty()) return;
+    std::string message = solver + " only implements a Jacobi preconditioned BiCGStab, ";
+    for (const auto& [setting, used] : unsupported)
+    {
+        message += "replace " + setting + " by " + used + "; ";
+    }
+    throw std::runtime_error(message + "or disable the " + solver);
+}
+
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "NeoN/NeoN.hpp"
+
+#include "Pstream.H"
+#include "PstreamReduceOps.H"
+#include "vector.H"
+
+#include "FoamAdapter/linearAlgebra/subdomainCoupling.hpp"
+#include "FoamAdapter/compatibility/fvSolution.hpp"
+
+namespace FoamAdapter
+{
+
+using scalar = NeoN::scalar;
+using Vec3 = NeoN::Vec3;
+
+CouplingControls CouplingControls::read(const NeoN::Dictionary& fieldSolverDict)
+{
+    CouplingControls controls {};
+    controls.maxIter = readIndex(fieldSolverDict, "maxCouplingIter", controls.maxIter);
+    return controls;
+}
+
+scalar globalNorm(const NeoN::Vector<scalar>& a)
+{
+    scalar sqrSum = 0.0;
+    const auto aView = a.view();
+    NeoN::parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const NeoN::localIdx i, scalar& sum) { sum += aView[i] * aView[i]; },
+        sqrSum
+    );
+    return std::sqrt(Foam::returnReduce(sqrSum, Foam::sumOp<Foam::scalar>()));
+}
+
+scalar globalNorm(const NeoN::Vector<Vec3>& a)
+{
+    Vec3 sqrSum(0.0, 0.0, 0.0);
+    const auto aView = a.view();
+    NeoN::parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const NeoN::localIdx i, Vec3& sum) {
+            const auto& ai = aView[i];
+            sum += Vec3(ai[0] * ai[0], ai[1] * ai[1], ai[2] * ai[2]);
+        },
+        sqrSum
+    );
+    const auto global = Foam::returnReduce(
+        Foam::vector(sqrSum[0], sqrSum[1], sqrSum[2]),
+        Foam::sumOp<Foam::vector>()
+    );
+    return std::sqrt(std::max({global.x(), global.y(), global.z()}));
+}
+
+NeoN::localIdx globalMax(NeoN::localIdx value)
+{
+    return static_cast<NeoN::localIdx>(
+        Foam::returnReduce(static_cast<Foam::label>(value), Foam::maxOp<Foam::label>())
+    );
+}
+
+void warnUnconverged(
+    const std::string& fieldName,
+    NeoN::localIdx nCouplingIter,
+    scalar finalResNorm,
+    scalar tol
+)
+{
+    if (!Foam::Pstream::master()) return;
+    std::cout << __FILE__ << ":\n\tthe subdomain coupling of " << fieldName
+              << " did not converge in " << nCouplingIter
+              << " iterations, residual: " << finalResNorm << " tolerance: " << tol
+              << ", increase maxCouplingIter or reduce the number of subdomains\n";
+}
+
+NeoN::Dictionary subdomainSolverDict(const NeoN::Dictionary& fieldSolverDict)
+{
+    NeoN::Dictionary result = fieldSolverDict;
+    if (!result.contains("criteria")) return result;
+    auto& criteriaDict = result.subDict("criteria");
+    if (criteriaDict.contains("absolute_residual_norm"))
+    {
+        const auto absTol = criteriaDict.get<scalar>("absolute_residual_norm");
+        criteriaDict.insert(
+            "absolute_residual_norm",
+            absTol / std::sqrt(static_cast<scalar>(Foam::Pstream::nProcs()))
+        );
+    }
+    return result;
+}
+
+}
@@ -58,6 +58,40 @@ TEST_CASE("fvSolution")
             REQUIRE(solver1.get<std::string>("solver") == "Ginkgo");
             REQUIRE(solver1.get<std::string>("type") == "solver::Bicgstab");
         }
+        SECTION("GAMG")
+        {
+            solver1.insert("solver", std::string("GAMG"));
+            solver1.insert("smoother", std::string("symGaussSeidel"));
+            solver1.insert("nPreSweeps", 1);
+            solver1.insert("nPostSweeps", 3);
+            solver1.insert("nCellsInCoarsestLevel", 50);
+            FoamAdapter::updateSolver(solver1);
+            REQUIRE(solver1.get<std::string>("solver") == "Ginkgo");
+            REQUIRE(solver1.get<std::string>("type") == "solver::Multigrid");
+            REQUIRE(solver1.get<int>("min_coarse_rows") == 50);
+            REQUIRE(solver1.get<std::string>("cycle") == "v");
+            REQUIRE(solver1.subDict("mg_level").get<std::string>("type") == "multigrid::Pgm");
+
+            auto& preSmoother = solver1.subDict("pre_smoother");
+            REQUIRE(preSmoother.get<std::string>("type") == "solver::Ir");
+            REQUIRE(preSmoother.subDict("criteria").get<int>("iteration") == 1);
+            REQUIRE(
+                preSmoother.subDict("solver").get<std::string>("type")
+                == "preconditioner::GaussSeidel"
+            );
+            REQUIRE(preSmoother.subDict("solver").get<bool>("symmetric") == true);
+            auto& postSmoother = solver1.subDict("post_smoother");
+            REQUIRE(postSmoother.subDict("criteria").get<int>("iteration") == 3);
+
+            // the OpenFOAM entries must not be passed on to Ginkgo
+            REQUIRE(!solver1.contains("smoother"));
+            REQUIRE(!solver1.contains("nPreSweeps"));
+            REQUIRE(!solver1.contains("nCellsInCoarsestLevel"));
+
+            // the multigrid solver needs no additional preconditioner
+            FoamAdapter::updatePreconditioner(solver1);
+            REQUIRE(!solver1.contains("preconditioner"));
+        }
     }
 
     SECTION("updatePreconditioner")
@@ -67,8 +101,41 @@ TEST_CASE("fvSolution")
             solver1.insert("preconditioner", std::string("DIC"));
             FoamAdapter::updatePreconditioner(solver1);
             auto& preconditionerDict = solver1.subDict("preconditioner");
+            REQUIRE(preconditionerDict.get<std::string>("type") == "preconditioner::Ic");
+            REQUIRE(
+                preconditionerDict.subDict("factorization").get<std::string>("type")
+                == "factorization::ParIc"
+            );
+            REQUIRE(FoamAdapter::containsType(solver1, "preconditioner::Ic"));
+            REQUIRE(!FoamAdapter::containsType(solver1, "preconditioner::Ilu"));
+        }
+        SECTION("DIC nSweeps")
+        {
+            solver1.insert(
+                "preconditioner",
+                NeoN::Dictionary(
+                    {{std::string("preconditioner"), std::string("DIC")},
+                     {std::string("nSweeps"), 3}}
+                )
+            );
+            FoamAdapter::updatePreconditioner(solver1);
+            auto& factorizationDict = solver1.subDict("preconditioner").subDict("factorization");
+            REQUIRE(factorizationDict.get<std::string>("type") == "factorization::ParIc");
+            REQUIRE(factorizationDict.get<int>("iterations") == 3);
+        }
+        SECTION("blockJacobi")
+        {
+            solver1.insert(
+                "preconditioner",
+                NeoN::Dictionary(
+                    {{std::string("preconditioner"), std::string("blockJacobi")},
+                     {std::string("maxBlockSize"), 64}}
+                )
+            );
+            FoamAdapter::updatePreconditioner(solver1);
+            auto& preconditionerDict = solver1.subDict("preconditioner");
             REQUIRE(preconditionerDict.get<std::string>("type") == "preconditioner::Jacobi");
-            REQUIRE(preconditionerDict.get<int>("max_block_size") == 1);
+            REQUIRE(preconditionerDict.get<int>("max_block_size") == 32);
         }
         SECTION("DILU")
         {
@@ -82,5 +149,35 @@ TEST_CASE("fvSolution")
                 == "factorization::ParIlu"
             );
         }
+        SECTION("GAMG")
+        {
+            solver1.insert(
+                "preconditioner",
+                NeoN::Dictionary(
+                    {{std::string("preconditioner"), std::string("GAMG")},
+                     {std::string("smoother"), std::string("DIC")},
+                     {std::string("nVcycles"), 1}}
+                )
+            );
+            FoamAdapter::updatePreconditioner(solver1);
+            auto& preconditionerDict = solver1.subDict("preconditioner");
+            REQUIRE(preconditionerDict.get<std::string>("type") == "solver::Multigrid");
+            REQUIRE(preconditionerDict.subDict("criteria").get<int>("iteration") == 1);
+            REQUIRE(
+                preconditionerDict.subDict("post_smoother").subDict("solver").get<std::string>(
+                    "type"
+                )
+                == "preconditioner::GaussSeidel"
+            );
+            REQUIRE(
+                preconditionerDict.subDict("post_smoother").subDict("solver").get<bool>(
+                    "symmetric"
+                )
+                == true
+            );
+            // OpenFOAM's default nPreSweeps 0 does not create a pre smoother
+            REQUIRE(!preconditionerDict.contains("pre_smoother"));
+            REQUIRE(!preconditionerDict.contains("preconditioner"));
+        }
     }
 }
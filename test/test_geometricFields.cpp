@@ -6,6 +6,8 @@
 
 #include "common.hpp"
 
+#include "linear.H"
+
 extern Foam::Time* timePtr; // A single time object
 
 TEST_CASE("VolumeField")
@@ -32,3 +34,61 @@ TEST_CASE("VolumeField")
         FoamAdapter::compare(nfU, ofU, ApproxVector(1e-15));
     }
 }
+
+TEST_CASE("CollatedWriter")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    Foam::Time& runTime = *timePtr;
+    auto meshPtr = FoamAdapter::createMesh(exec, runTime);
+    FoamAdapter::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofT = randomScalarField(runTime, mesh, "T");
+    auto ofU = randomVectorField(runTime, mesh, "U");
+    auto nfT = FoamAdapter::constructFrom(exec, nfMesh, ofT);
+    auto nfU = FoamAdapter::constructFrom(exec, nfMesh, ofU);
+    Foam::surfaceScalarField ofTf(
+        Foam::IOobject(
+            "Tf",
+            runTime.timeName(),
+            mesh,
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE
+        ),
+        Foam::linearInterpolate(ofT)
+    );
+    auto nfTf = FoamAdapter::constructSurfaceField(exec, nfMesh, ofTf);
+
+    FoamAdapter::CollatedWriter writer(runTime, 0);
+
+    SECTION("missing field " + execName)
+    {
+        REQUIRE_FALSE(writer.contains("missing"));
+        REQUIRE_FALSE(writer.read(nfT, "missing"));
+    }
+
+    SECTION("round trip " + execName)
+    {
+        writer.write(nfT, "T");
+        writer.write(nfU, "U");
+        writer.write(nfTf, "Tf");
+        REQUIRE(writer.contains("Tf"));
+
+        // overwrite the values, the read restores internal and boundary values
+        NeoN::fill(nfT.internalVector(), 0.0);
+        NeoN::fill(nfT.boundaryData().value(), 0.0);
+        NeoN::fill(nfU.internalVector(), NeoN::zero<NeoN::Vec3>());
+        NeoN::fill(nfU.boundaryData().value(), NeoN::zero<NeoN::Vec3>());
+        NeoN::fill(nfTf.internalVector(), 0.0);
+        NeoN::fill(nfTf.boundaryData().value(), 0.0);
+        REQUIRE(writer.read(nfT, "T"));
+        REQUIRE(writer.read(nfU, "U"));
+        REQUIRE(writer.read(nfTf, "Tf"));
+        FoamAdapter::compare(nfT, ofT, ApproxScalar(1e-15));
+        FoamAdapter::compare(nfU, ofU, ApproxVector(1e-15));
+        FoamAdapter::compare(nfTf, ofTf, ApproxScalar(1e-15));
+    }
+
+    std::filesystem::remove_all(writer.directory().parent_path());
+}
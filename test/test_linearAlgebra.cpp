@@ -0,0 +1,498 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <numeric>
+
+#include "common.hpp"
+
+using Foam::Info;
+using Foam::endl;
+
+namespace dsl = NeoN::dsl;
+namespace nnfvcc = NeoN::finiteVolume::cellCentred;
+namespace nf = FoamAdapter;
+
+extern Foam::Time* timePtr; // A single time object
+
+
+TEST_CASE("LinearAlgebra")
+{
+    Foam::Time& runTime = *timePtr;
+
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto rt = nf::createAdapterRunTime(runTime, exec);
+    auto& mesh = rt.mesh;
+
+    auto ofU = randomVectorField(runTime, mesh, "ofU");
+    ofU.correctBoundaryConditions();
+
+    auto& vectorCollection = nnfvcc::VectorCollection::instance(rt.db, "VectorCollection");
+    nnfvcc::VolumeField<NeoN::Vec3>& nfU =
+        vectorCollection.registerVector<nnfvcc::VolumeField<NeoN::Vec3>>(
+            FoamAdapter::CreateFromFoamField<Foam::volVectorField> {
+                .exec = rt.exec,
+                .nfMesh = rt.nfMesh,
+                .foamField = ofU,
+                .name = "nfU"
+            }
+        );
+
+    auto& nfOldU = fvcc::oldTime(nfU);
+    nfOldU.internalVector() = nfU.internalVector();
+    nfOldU.correctBoundaryConditions();
+
+    Foam::surfaceScalarField ofPhi(
+        Foam::IOobject(
+            "ofPhi",
+            runTime.timeName(),
+            mesh,
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE
+        ),
+        Foam::fvc::flux(ofU)
+    );
+    auto nfPhi = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, ofPhi);
+    nfPhi.name = "nfPhi";
+
+    auto nuBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(rt.nfMesh);
+    fvcc::SurfaceField<NeoN::scalar> nfNu(rt.exec, "nfNu", rt.nfMesh, nuBCs);
+    NeoN::fill(nfNu.internalVector(), 0.01);
+    NeoN::fill(nfNu.boundaryData().value(), 0.01);
+
+    nf::PDESolver<NeoN::Vec3> nfUEqn(
+        dsl::imp::ddt(nfU) + dsl::imp::div(nfPhi, nfU) - dsl::imp::laplacian(nfNu, nfU),
+        nfU,
+        rt
+    );
+    nfUEqn.assemble();
+
+    NeoN::Dictionary solverDict(
+        {{std::string("criteria"),
+          NeoN::Dictionary(
+              {{std::string("iteration"), 1000},
+               {std::string("absolute_residual_norm"), NeoN::scalar(1e-12)}}
+          )}}
+    );
+
+    // the residual of the original Vec3 system has to vanish for every component
+    auto requireSolved = [&](const NeoN::la::LinearSystem<NeoN::Vec3, NeoN::localIdx>& ls)
+    {
+        auto res = nf::applyOperator(ls, nfU);
+        auto resHost = res.internalVector().copyToHost();
+        NeoN::Vec3 sqrRes(0.0, 0.0, 0.0);
+        for (auto celli = 0; celli < resHost.size(); celli++)
+        {
+            for (int cmpt = 0; cmpt < 3; cmpt++)
+            {
+                sqrRes[cmpt] += resHost.view()[celli][cmpt] * resHost.view()[celli][cmpt];
+            }
+        }
+        for (int cmpt = 0; cmpt < 3; cmpt++)
+        {
+            REQUIRE(std::sqrt(sqrRes[cmpt]) == Catch::Approx(0.0).margin(1e-10));
+        }
+    };
+
+    SECTION("batched solve " + execName)
+    {
+        auto stats = nf::batchedSolve(nfUEqn.linearSystem(), nfU.internalVector(), solverDict);
+
+        REQUIRE(stats.numIter > 0);
+        REQUIRE(stats.finalResNorm <= 1e-12);
+        requireSolved(nfUEqn.linearSystem());
+    }
+
+    SECTION("anisotropic coefficients " + execName)
+    {
+        REQUIRE(nf::isotropicCoefficients(nfUEqn.linearSystem()));
+
+        // doubles the coefficients of the x component, the batched solver uses the Vec3 values
+        auto ls = nfUEqn.linearSystem();
+        auto values = ls.matrix().values().view();
+        NeoN::parallelFor(
+            exec,
+            {0, values.size()},
+            KOKKOS_LAMBDA(const size_t i) { values[i][0] *= 2.0; }
+        );
+        REQUIRE(!nf::isotropicCoefficients(ls));
+
+        auto stats = nf::batchedSolve(ls, nfU.internalVector(), solverDict);
+        REQUIRE(stats.finalResNorm <= 1e-12);
+        requireSolved(ls);
+    }
+
+    SECTION("unsupported settings " + execName)
+    {
+        NeoN::Dictionary gamgDict({{std::string("solver"), std::string("GAMG")}});
+        REQUIRE_THROWS_AS(
+            nf::batchedSolve(nfUEqn.linearSystem(), nfU.internalVector(), gamgDict),
+            std::runtime_error
+        );
+    }
+
+    SECTION("scalar coefficients " + execName)
+    {
+        auto values = nf::scalarCoefficients(nfUEqn.linearSystem());
+        auto valuesHost = values.copyToHost();
+        auto vec3ValuesHost = nfUEqn.linearSystem().matrix().values().copyToHost();
+
+        REQUIRE(valuesHost.size() == vec3ValuesHost.size());
+        for (auto i = 0; i < valuesHost.size(); i++)
+        {
+            REQUIRE(valuesHost.view()[i] == vec3ValuesHost.view()[i][0]);
+            REQUIRE(valuesHost.view()[i] == vec3ValuesHost.view()[i][1]);
+            REQUIRE(valuesHost.view()[i] == vec3ValuesHost.view()[i][2]);
+        }
+    }
+
+    SECTION("isotropic linear system " + execName)
+    {
+        const auto& ls = nfUEqn.linearSystem();
+        nf::IsotropicLinearSystem<NeoN::localIdx> isoLs(ls);
+
+        // the column indices are narrowed to connectivityIdx
+        auto isoColIdxsHost = isoLs.colIdxs().copyToHost();
+        auto colIdxsHost = ls.matrix().colIdxs().copyToHost();
+        REQUIRE(isoColIdxsHost.size() == colIdxsHost.size());
+        for (auto i = 0; i < colIdxsHost.size(); i++)
+        {
+            REQUIRE(isoColIdxsHost.view()[i] == colIdxsHost.view()[i]);
+        }
+
+        // the mesh narrows the column indices once and shares them between the systems
+        const auto& pattern = nfUEqn.sparsityPattern();
+        auto cached = rt.mesh.compactColIdxs(pattern);
+        REQUIRE(rt.mesh.compactColIdxs(pattern) == cached);
+        REQUIRE(cached->size() == pattern.colIdxs().size());
+        nf::IsotropicLinearSystem<NeoN::localIdx> sharedLs(ls, cached);
+        REQUIRE(&sharedLs.colIdxs() == cached.get());
+
+        // the isotropic residual has to match the residual of the Vec3 system
+        NeoN::Vector<NeoN::Vec3> isoRes(rt.exec, nfU.internalVector().size());
+        nf::computeResidual(isoLs, nfU.internalVector(), isoRes);
+        auto res = nf::applyOperator(ls, nfU);
+        auto isoResHost = isoRes.copyToHost();
+        auto resHost = res.internalVector().copyToHost();
+        for (auto celli = 0; celli < resHost.size(); celli++)
+        {
+            for (int cmpt = 0; cmpt < 3; cmpt++)
+            {
+                REQUIRE(
+                    isoResHost.view()[celli][cmpt]
+                    == Catch::Approx(resHost.view()[celli][cmpt]).margin(1e-12)
+                );
+            }
+        }
+
+        auto isoDiagHost = nf::diag(isoLs, nfUEqn.sparsityPattern()).copyToHost();
+        auto vec3ValuesHost = ls.matrix().values().copyToHost();
+        auto rowOffsHost = ls.matrix().rowOffs().copyToHost();
+        auto diagOffsHost = nfUEqn.sparsityPattern().diagOffset().copyToHost();
+        for (auto celli = 0; celli < isoDiagHost.size(); celli++)
+        {
+            auto diagIdx = rowOffsHost.view()[celli] + diagOffsHost.view()[celli];
+            REQUIRE(isoDiagHost.view()[celli] == vec3ValuesHost.view()[diagIdx][0]);
+        }
+    }
+}
+
+TEST_CASE("ScalarLinearSystem")
+{
+    Foam::Time& runTime = *timePtr;
+
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto rt = nf::createAdapterRunTime(runTime, exec);
+    auto& mesh = rt.mesh;
+
+    auto ofT = randomScalarField(runTime, mesh, "ofT");
+    fvcc::VolumeField<NeoN::scalar> nfT = nf::constructFrom(rt.exec, rt.nfMesh, ofT);
+
+    // a diagonal system with nfT as exact solution
+    auto coefficients = nfT;
+    NeoN::fill(coefficients.internalVector(), 2.0);
+    fvcc::SourceTerm sourceTerm(dsl::Operator::Type::Implicit, coefficients, nfT);
+    const auto sparsityPattern = NeoN::la::createSparsity(rt.nfMesh);
+    auto ls =
+        NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(rt.nfMesh, sparsityPattern);
+    sourceTerm.implicitOperation(ls);
+
+    const auto& exact = nfT.internalVector();
+    NeoN::Vector<NeoN::scalar> res(rt.exec, exact.size(), 0.0);
+    NeoN::la::computeResidual(ls.matrix(), ls.rhs(), exact, res);
+    {
+        const auto resView = res.view();
+        auto rhs = ls.rhs().view();
+        ls.rhs().apply(KOKKOS_LAMBDA(const size_t i) { return rhs[i] - resView[i]; });
+    }
+
+    const auto exactView = exact.view();
+    auto scaled = [&](NeoN::scalar factor)
+    {
+        NeoN::Vector<NeoN::scalar> result(rt.exec, exact.size(), 0.0);
+        result.apply(KOKKOS_LAMBDA(const size_t i) { return factor * exactView[i]; });
+        return result;
+    };
+
+    auto requireExact = [&](const NeoN::Vector<NeoN::scalar>& x)
+    {
+        auto xHost = x.copyToHost();
+        auto exactHost = exact.copyToHost();
+        for (auto celli = 0; celli < xHost.size(); celli++)
+        {
+            REQUIRE(xHost.view()[celli] == Catch::Approx(exactHost.view()[celli]).margin(1e-10));
+        }
+    };
+
+    nf::InitialGuess history;
+
+    SECTION("previous " + execName)
+    {
+        nf::InitialGuessControls controls {};
+        auto x = scaled(0.5);
+        history.store(controls, 0.0, x);
+        auto stats = history.apply(controls, ls, 1.0, x);
+
+        REQUIRE(stats.residualRatio() == 1.0);
+        REQUIRE(stats.iterationsSaved(NeoN::la::SolverStats {}) == 0.0);
+    }
+
+    SECTION("extrapolate " + execName)
+    {
+        nf::InitialGuessControls controls {.type = nf::InitialGuessType::extrapolate};
+        history.store(controls, 0.0, scaled(0.0));
+        // the last corrector of a time step replaces the earlier ones
+        history.store(controls, 1.0, scaled(0.25));
+        history.store(controls, 1.0, scaled(0.5));
+
+        // x0 + 2 (x1 - x0) = exact
+        auto x = scaled(0.5);
+        auto stats = history.apply(controls, ls, 2.0, x);
+
+        REQUIRE(stats.guessResNorm < stats.previousResNorm);
+        REQUIRE(stats.residualRatio() == Catch::Approx(0.0).margin(1e-10));
+        requireExact(x);
+
+        // no extrapolation for a corrector of the current time step
+        auto y = scaled(0.5);
+        stats = history.apply(controls, ls, 1.0, y);
+        REQUIRE(stats.residualRatio() == 1.0);
+    }
+
+    SECTION("projection " + execName)
+    {
+        nf::InitialGuessControls controls {
+            .type = nf::InitialGuessType::projection, .nProjectionVectors = 2
+        };
+        history.store(controls, 0.0, scaled(3.0));
+
+        auto x = scaled(0.0);
+        NeoN::fill(x, 1.0);
+        auto stats = history.apply(controls, ls, 1.0, x);
+
+        REQUIRE(stats.guessResNorm < stats.previousResNorm);
+        REQUIRE(stats.residualRatio() == Catch::Approx(0.0).margin(1e-10));
+        requireExact(x);
+    }
+
+    SECTION("mixed precision " + execName)
+    {
+        auto criteria = nf::SolverCriteria {.maxIter = 100, .relTol = 1e-12};
+        auto x = scaled(0.0);
+        nf::MixedPrecisionControls controls {};
+        auto stats = nf::mixedPrecisionSolve(ls, sparsityPattern, x, criteria, controls);
+
+        // iterative refinement reaches an accuracy beyond single precision
+        REQUIRE(stats.finalResNorm <= 1e-12 * stats.initResNorm);
+        requireExact(x);
+
+        // the float copy is reused while the pattern is unchanged
+        nf::SinglePrecisionMatrix matrix;
+        matrix.update(ls, sparsityPattern);
+        const auto* values = &matrix.values();
+        matrix.update(ls, sparsityPattern);
+        REQUIRE(&matrix.values() == values);
+
+        // the inner iterations only implement a Jacobi preconditioned BiCGStab
+        NeoN::Dictionary cgDict({{std::string("type"), std::string("solver::Cg")}});
+        REQUIRE_THROWS_AS(nf::mixedPrecisionSolve(ls, x, cgDict, matrix), std::runtime_error);
+    }
+}
+
+
+TEST_CASE("SolverTelemetry")
+{
+    nf::SolveRecord record {
+        .field = "p",
+        .t = 0.5,
+        .dt = 0.1,
+        .solver = "solver::Cg",
+        .nRows = 1000,
+        .nNonZeros = 5000,
+        .timings = {.assembly = 1.0, .solve = 1e-3},
+    };
+    record.stats.numIter = 10;
+
+    SECTION("flop estimate")
+    {
+        // one spmv and five vector operations per iteration
+        REQUIRE(record.flopsPerIteration() == Catch::Approx(2.0 * 5000 + 10.0 * 1000));
+        REQUIRE(record.gflops().value() == Catch::Approx(20000.0 * 10 / 1e-3 * 1e-9));
+
+        record.nRhs = 3;
+        REQUIRE(record.flopsPerIteration() == Catch::Approx(3 * 20000.0));
+
+        record.solver = "solver::Multigrid";
+        REQUIRE(record.flopsPerIteration() == 0.0);
+        REQUIRE(!record.gflops());
+    }
+
+    SECTION("json")
+    {
+        auto json = nf::toJson(record);
+        REQUIRE(json.front() == '{');
+        REQUIRE(json.back() == '}');
+        REQUIRE(json.find("\"field\":\"p\"") != std::string::npos);
+        REQUIRE(json.find("\"iterations\":10") != std::string::npos);
+        REQUIRE(json.find("\"preconditionerSetupTime\":null") != std::string::npos);
+        REQUIRE(json.find("\"assemblyTime\":1,") != std::string::npos);
+
+        record.timings.setup = 0.25;
+        REQUIRE(nf::toJson(record).find("\"preconditionerSetupTime\":0.25") != std::string::npos);
+
+        // assembled and solved by a single NeoN call
+        record.timings.assembly.reset();
+        REQUIRE(nf::toJson(record).find("\"assemblyTime\":null") != std::string::npos);
+    }
+}
+
+
+TEST_CASE("FirstTouch")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::vector<NeoN::scalar> data(1000);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    SECTION("copy " + execName)
+    {
+        auto vector = nf::firstTouchVector(exec, data.data(), data.size());
+        auto host = vector.copyToHost();
+        REQUIRE(host.size() == data.size());
+        for (std::size_t i = 0; i < data.size(); i++)
+        {
+            REQUIRE(host.view()[i] == data[i]);
+        }
+    }
+
+    SECTION("fill " + execName)
+    {
+        auto vector = nf::firstTouchVector(exec, data.size(), NeoN::Vec3(1.0, 2.0, 3.0));
+        auto host = vector.copyToHost();
+        REQUIRE(host.size() == data.size());
+        for (std::size_t i = 0; i < data.size(); i++)
+        {
+            REQUIRE(host.view()[i] == NeoN::Vec3(1.0, 2.0, 3.0));
+        }
+    }
+}
+
+TEST_CASE("VectorPool")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    SECTION("reuse " + execName)
+    {
+        auto& pool = nf::VectorPool<NeoN::scalar>::instance();
+        pool.clear();
+        // the statistics cover the pools of all value types, which other tests may have filled
+        const auto& stats = nf::vectorPoolStatistics();
+        const auto acquires = stats.acquires;
+        const auto hits = stats.hits;
+        const auto cachedBytes = stats.cachedBytes;
+
+        const NeoN::scalar* data = nullptr;
+        {
+            nf::PooledVector<NeoN::scalar> first(exec, 1234, 1.0);
+            data = first->data();
+        }
+        REQUIRE(stats.cachedBytes == cachedBytes + 1234 * sizeof(NeoN::scalar));
+        {
+            nf::PooledVector<NeoN::scalar> second(exec, 1234, 2.0);
+            REQUIRE(second->data() == data);
+            auto host = second->copyToHost();
+            REQUIRE(host.view()[1233] == 2.0);
+            // a different size is a different class
+            nf::PooledVector<NeoN::scalar> third(exec, 100);
+            REQUIRE(third->size() == 100);
+        }
+        REQUIRE(stats.acquires == acquires + 3);
+        REQUIRE(stats.hits == hits + 1);
+
+        pool.clear();
+        REQUIRE(stats.cachedBytes == cachedBytes);
+    }
+
+    SECTION("clear all pools " + execName)
+    {
+        {
+            nf::PooledVector<NeoN::scalar> scalars(exec, 10);
+            nf::PooledVector<NeoN::Vec3> vectors(exec, 10);
+        }
+        REQUIRE(nf::vectorPoolStatistics().cachedBytes > 0);
+        nf::clearVectorPools();
+        REQUIRE(nf::vectorPoolStatistics().cachedBytes == 0);
+    }
+
+    SECTION("temporary fields " + execName)
+    {
+        auto rt = nf::createAdapterRunTime(*timePtr, exec);
+        const auto& stats = nf::vectorPoolStatistics();
+        nf::clearVectorPools();
+        const auto nValues = rt.nfMesh.nCells() + rt.nfMesh.nBoundaryFaces();
+        {
+            nf::SoAVolumeField hByA(rt.nfMesh, "HbyA");
+        }
+        REQUIRE(stats.cachedBytes == 3 * nValues * sizeof(NeoN::scalar));
+        const auto hits = stats.hits;
+        {
+            nf::SoAVolumeField gradP(rt.nfMesh, "gradP");
+        }
+        REQUIRE(stats.hits == hits + 6);
+        nf::clearVectorPools();
+
+        // a released field is reused with its boundary conditions, without constructing a field
+        auto createBCs = [&]()
+        { return fvcc::createExtrapolatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(rt.nfMesh); };
+        const fvcc::VolumeField<NeoN::scalar>* released = nullptr;
+        {
+            nf::PooledVolumeField<NeoN::scalar> rAU(
+                rt.fieldPool,
+                exec,
+                "rAU",
+                rt.nfMesh,
+                createBCs
+            );
+            released = &*rAU;
+        }
+        const auto fieldHits = stats.hits;
+        {
+            nf::PooledVolumeField<NeoN::scalar> rAU(
+                rt.fieldPool,
+                exec,
+                "rAU",
+                rt.nfMesh,
+                createBCs
+            );
+            REQUIRE(&*rAU == released);
+            REQUIRE(rAU->internalVector().size() == rt.nfMesh.nCells());
+        }
+        REQUIRE(stats.hits == fieldHits + 1);
+        rt.fieldPool.clear();
+        REQUIRE(stats.cachedBytes == 0);
+    }
+}
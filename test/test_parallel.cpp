@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+// SPDX-FileCopyrightText: 2025 FoamAdapter authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <cmath>
+#include <filesystem>
+
+#include "common.hpp"
+
+using Foam::Info;
+using Foam::endl;
+
+namespace dsl = NeoN::dsl;
+namespace nnfvcc = NeoN::finiteVolume::cellCentred;
+namespace nf = FoamAdapter;
+
+extern Foam::Time* timePtr; // A single time object
+
+
+/* The test runs serially and decomposed, ie. mpirun -np 2 adapter_parallel --- -parallel. The
+ * reference is the solution of OpenFOAM, whose solvers are globally coupled and hence reproduce
+ * the serial solution for the decomposed mesh up to the solver tolerance.
+ */
+TEST_CASE("DecomposedSolve")
+{
+    Foam::Time& runTime = *timePtr;
+
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto rt = nf::createAdapterRunTime(runTime, exec);
+    auto& mesh = rt.mesh;
+    auto& solverDict = rt.fvSolutionDict.get<NeoN::Dictionary>("solvers");
+
+    auto ofU = randomVectorField(runTime, mesh, "ofU");
+    ofU.correctBoundaryConditions();
+    auto& oldOfU = ofU.oldTime();
+    oldOfU.primitiveFieldRef() = Foam::vector(0.0, 0.0, 0.0);
+    oldOfU.correctBoundaryConditions();
+    auto ofp = randomScalarField(runTime, mesh, "ofp");
+    ofp.correctBoundaryConditions();
+
+    auto& vectorCollection = nnfvcc::VectorCollection::instance(rt.db, "VectorCollection");
+    nnfvcc::VolumeField<NeoN::Vec3>& nfU =
+        vectorCollection.registerVector<nnfvcc::VolumeField<NeoN::Vec3>>(
+            FoamAdapter::CreateFromFoamField<Foam::volVectorField> {
+                .exec = rt.exec,
+                .nfMesh = rt.nfMesh,
+                .foamField = ofU,
+                .name = "nfU"
+            }
+        );
+    nnfvcc::VolumeField<NeoN::scalar>& nfp =
+        vectorCollection.registerVector<nnfvcc::VolumeField<NeoN::scalar>>(
+            FoamAdapter::CreateFromFoamField<Foam::volScalarField> {
+                .exec = rt.exec,
+                .nfMesh = rt.nfMesh,
+                .foamField = ofp,
+                .name = "nfp"
+            }
+        );
+    nf::exchangeHalo(nfU, mesh);
+    nf::exchangeHalo(nfp, mesh);
+
+    auto& nfOldU = fvcc::oldTime(nfU);
+    NeoN::fill(nfOldU.internalVector(), NeoN::Vec3(0.0, 0.0, 0.0));
+    nfOldU.correctBoundaryConditions();
+
+    Foam::surfaceScalarField ofPhi(
+        Foam::IOobject(
+            "ofPhi",
+            runTime.timeName(),
+            mesh,
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE
+        ),
+        Foam::fvc::flux(ofU)
+    );
+    auto nfPhi = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, ofPhi);
+    nfPhi.name = "nfPhi";
+
+    auto requireEqual = [](const auto& nfValues, const auto& ofValues, auto approx)
+    {
+        auto host = nfValues.copyToHost();
+        REQUIRE_THAT(
+            host.view({0, static_cast<size_t>(ofValues.size())}),
+            Catch::Matchers::RangeEquals(
+                std::span(ofValues.cdata(), static_cast<size_t>(ofValues.size())),
+                approx
+            )
+        );
+    };
+
+    SECTION("pressure " + execName)
+    {
+        Foam::surfaceScalarField forAUf(
+            Foam::IOobject(
+                "forAUf",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("forAUf", Foam::dimensionSet(0, 0, 1, 0, 0), 0.1)
+        );
+        auto nfrAUf = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, forAUf);
+        nfrAUf.name = "nfrAUf";
+
+        solverDict.insert(
+            "nfp",
+            nf::mapFvSolution(NeoN::Dictionary(
+                {{std::string("solver"), std::string("PCG")},
+                 {std::string("preconditioner"), std::string("DIC")},
+                 {std::string("tolerance"), NeoN::scalar(1e-12)},
+                 {std::string("relTol"), NeoN::scalar(0.0)}}
+            ))
+        );
+        nf::PDESolver<NeoN::scalar> pEqn(
+            dsl::imp::laplacian(nfrAUf, nfp) - dsl::exp::div(nfPhi),
+            nfp,
+            rt
+        );
+        auto stats = pEqn.solve();
+
+        Foam::dictionary ofSolverDict;
+        ofSolverDict.add("solver", Foam::word("PCG"));
+        ofSolverDict.add("preconditioner", Foam::word("DIC"));
+        ofSolverDict.add("tolerance", 1e-14);
+        ofSolverDict.add("relTol", 0.0);
+        Foam::fvScalarMatrix ofpEqn(fvm::laplacian(forAUf, ofp) == fvc::div(ofPhi));
+        ofpEqn.solve(ofSolverDict);
+
+        // the residual is the one of the undecomposed system
+        REQUIRE(std::isfinite(stats.finalResNorm));
+        REQUIRE(stats.finalResNorm <= 1e-12);
+        requireEqual(nfp.internalVector(), ofp.primitiveField(), ApproxScalar(1e-8));
+    }
+
+    SECTION("momentum " + execName)
+    {
+        auto batched = GENERATE(false, true);
+
+        Foam::surfaceScalarField ofNu(
+            Foam::IOobject(
+                "ofNu",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("ofNu", Foam::dimensionSet(0, 2, -1, 0, 0), 0.01)
+        );
+        auto nfNu = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, ofNu);
+        nfNu.name = "nfNu";
+
+        solverDict.insert(
+            "nfU",
+            nf::mapFvSolution(NeoN::Dictionary(
+                {{std::string("solver"), std::string("PBiCGStab")},
+                 {std::string("preconditioner"), std::string("diagonal")},
+                 {std::string("tolerance"), NeoN::scalar(1e-12)},
+                 {std::string("relTol"), NeoN::scalar(0.0)},
+                 {std::string("batched"), batched}}
+            ))
+        );
+        nf::PDESolver<NeoN::Vec3> nfUEqn(
+            dsl::imp::ddt(nfU) + dsl::imp::div(nfPhi, nfU) - dsl::imp::laplacian(nfNu, nfU),
+            nfU,
+            rt
+        );
+        auto stats = nfUEqn.solve();
+
+        Foam::dictionary ofSolverDict;
+        ofSolverDict.add("solver", Foam::word("PBiCGStab"));
+        ofSolverDict.add("preconditioner", Foam::word("diagonal"));
+        ofSolverDict.add("tolerance", 1e-14);
+        ofSolverDict.add("relTol", 0.0);
+        Foam::fvVectorMatrix ofUEqn(
+            fvm::ddt(ofU) + fvm::div(ofPhi, ofU) - fvm::laplacian(ofNu, ofU)
+        );
+        ofUEqn.solve(ofSolverDict);
+
+        REQUIRE(std::isfinite(stats.finalResNorm));
+        REQUIRE(stats.finalResNorm <= 1e-12);
+        auto host = nfU.internalVector().copyToHost();
+        forAll(ofU, celli)
+        {
+            for (int cmpt = 0; cmpt < 3; cmpt++)
+            {
+                REQUIRE(
+                    host.view()[celli][cmpt] == Catch::Approx(ofU[celli][cmpt]).margin(1e-8)
+                );
+            }
+        }
+    }
+}
+
+/* Decomposed, the writer exchanges offsets with MPI_Exscan, writes with MPI_File_write_at_all
+ * and gathers and scatters the index, either one file per rank or one file per node.
+ */
+TEST_CASE("CollatedWriter")
+{
+    Foam::Time& runTime = *timePtr;
+
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto groupSize = GENERATE(0, 1);
+
+    auto meshPtr = nf::createMesh(exec, runTime);
+    nf::MeshAdapter& mesh = *meshPtr;
+    auto nfMesh = mesh.nfMesh();
+
+    auto ofp = randomScalarField(runTime, mesh, "ofp");
+    auto ofU = randomVectorField(runTime, mesh, "ofU");
+    Foam::surfaceScalarField ofPhi(
+        Foam::IOobject(
+            "ofPhi",
+            runTime.timeName(),
+            mesh,
+            Foam::IOobject::NO_READ,
+            Foam::IOobject::NO_WRITE
+        ),
+        Foam::fvc::flux(ofU)
+    );
+    auto nfp = nf::constructFrom(exec, nfMesh, ofp);
+    auto nfU = nf::constructFrom(exec, nfMesh, ofU);
+    auto nfPhi = nf::constructSurfaceField(exec, nfMesh, ofPhi);
+
+    nf::CollatedWriter writer(runTime, groupSize);
+
+    SECTION("round trip " + execName + " groupSize " + std::to_string(groupSize))
+    {
+        writer.write(nfp, "p");
+        writer.write(nfU, "U");
+        writer.write(nfPhi, "phi");
+        REQUIRE(writer.contains("p"));
+        REQUIRE(writer.contains("U"));
+        REQUIRE(writer.contains("phi"));
+        if (groupSize == 1)
+        {
+            const auto file = "p." + std::to_string(Foam::Pstream::myProcNo());
+            REQUIRE(std::filesystem::exists(writer.directory() / file));
+        }
+
+        // overwrite the values, the read restores internal and boundary values of every rank
+        NeoN::fill(nfp.internalVector(), 0.0);
+        NeoN::fill(nfp.boundaryData().value(), 0.0);
+        NeoN::fill(nfU.internalVector(), NeoN::zero<NeoN::Vec3>());
+        NeoN::fill(nfU.boundaryData().value(), NeoN::zero<NeoN::Vec3>());
+        NeoN::fill(nfPhi.internalVector(), 0.0);
+        NeoN::fill(nfPhi.boundaryData().value(), 0.0);
+        REQUIRE(writer.read(nfp, "p"));
+        REQUIRE(writer.read(nfU, "U"));
+        REQUIRE(writer.read(nfPhi, "phi"));
+        nf::compare(nfp, ofp, ApproxScalar(1e-15));
+        nf::compare(nfU, ofU, ApproxVector(1e-15));
+        nf::compare(nfPhi, ofPhi, ApproxScalar(1e-15));
+    }
+
+    // the files are shared, hence only the first rank removes them once all ranks are done
+    if (Foam::Pstream::parRun()) MPI_Barrier(MPI_COMM_WORLD);
+    if (Foam::Pstream::master()) std::filesystem::remove_all(writer.directory().parent_path());
+    if (Foam::Pstream::parRun()) MPI_Barrier(MPI_COMM_WORLD);
+}
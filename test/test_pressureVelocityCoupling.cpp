@@ -4,6 +4,8 @@
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
 
+#include <cmath>
+
 #include "common.hpp"
 #include "constrainHbyA.H"
 
@@ -109,6 +111,97 @@ TEST_CASE("PressureVelocityCoupling")
     NeoN::Dictionary fvSolutionDict = FoamAdapter::convert(mesh.solutionDict());
     auto& solverDict = fvSolutionDict.get<NeoN::Dictionary>("solvers");
 
+    SECTION("CourantTimeStepControl " + execName)
+    {
+        nf::CourantTimeStepControl coControl(mesh);
+        coControl.start(nfPhi, dt);
+        coControl.setDeltaT(runTime, rt);
+        REQUIRE(coControl.coNum() == Catch::Approx(nnfvcc::computeCoNum(nfPhi, dt)).epsilon(1e-12));
+        REQUIRE(rt.dt == runTime.deltaTValue());
+
+        // the other sections use the initial time step
+        runTime.setDeltaT(dt);
+        rt.dt = dt;
+    }
+
+    SECTION("pressure solve DIC " + execName)
+    {
+        Foam::surfaceScalarField forAUf(
+            Foam::IOobject(
+                "forAUf",
+                runTime.timeName(),
+                mesh,
+                Foam::IOobject::NO_READ,
+                Foam::IOobject::NO_WRITE
+            ),
+            mesh,
+            Foam::dimensionedScalar("forAUf", Foam::dimensionSet(0, 0, 1, 0, 0), 0.1)
+        );
+        auto nfrAUf = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, forAUf);
+        nfrAUf.name = "nfrAUf";
+
+        // the pressure equation is negative definite, which incomplete Cholesky cannot factorize
+        rt.fvSolutionDict.get<NeoN::Dictionary>("solvers").insert(
+            "nfp",
+            nf::mapFvSolution(NeoN::Dictionary(
+                {{std::string("solver"), std::string("PCG")},
+                 {std::string("preconditioner"), std::string("DIC")},
+                 {std::string("tolerance"), NeoN::scalar(1e-12)},
+                 {std::string("relTol"), NeoN::scalar(0.0)}}
+            ))
+        );
+        nf::PDESolver<NeoN::scalar> pEqn(
+            dsl::imp::laplacian(nfrAUf, nfp) - dsl::exp::div(nfPhi),
+            nfp,
+            rt
+        );
+        auto stats = pEqn.solve();
+
+        Foam::dictionary ofSolverDict;
+        ofSolverDict.add("solver", Foam::word("PCG"));
+        ofSolverDict.add("preconditioner", Foam::word("DIC"));
+        ofSolverDict.add("tolerance", 1e-12);
+        ofSolverDict.add("relTol", 0.0);
+        Foam::fvScalarMatrix ofpEqn(fvm::laplacian(forAUf, ofp) == fvc::div(ofPhi));
+        ofpEqn.solve(ofSolverDict);
+
+        REQUIRE(stats.numIter < 1000);
+        REQUIRE(std::isfinite(stats.finalResNorm));
+        REQUIRE(stats.finalResNorm <= 1e-12);
+        auto hostP = nfp.internalVector().copyToHost();
+        forAll(ofp, celli)
+        {
+            REQUIRE(hostP.view()[celli] == Catch::Approx(ofp[celli]).margin(1e-8));
+        }
+
+        // the flux reads the assembled system, which is negated for the solve
+        Foam::surfaceScalarField ofPhi0("ofPhi0", ofPhi - ofpEqn.flux());
+        auto nfPhi0 = FoamAdapter::constructSurfaceField(rt.exec, rt.nfMesh, ofPhi0);
+        nfPhi0.name = "nfPhi0";
+        NeoN::fill(nfPhi0.internalVector(), 0.0);
+        NeoN::fill(nfPhi0.boundaryData().value(), 0.0);
+        nf::updateFaceVelocity(nfPhi, pEqn, nfPhi0);
+
+        auto hostPhi0 = nfPhi0.internalVector().copyToHost();
+        forAll(ofPhi0, facei)
+        {
+            REQUIRE(hostPhi0.view()[facei] == Catch::Approx(ofPhi0[facei]).margin(1e-8));
+        }
+        auto hostBCPhi0 = nfPhi0.boundaryData().value().copyToHost();
+        forAll(ofPhi0.boundaryField(), patchi)
+        {
+            const Foam::fvsPatchScalarField& ofPhi0Patch = ofPhi0.boundaryField()[patchi];
+            auto [start, end] = nfPhi0.boundaryData().range(patchi);
+            forAll(ofPhi0Patch, bfacei)
+            {
+                REQUIRE(
+                    hostBCPhi0.view()[start + bfacei]
+                    == Catch::Approx(ofPhi0Patch[bfacei]).margin(1e-8)
+                );
+            }
+        }
+    }
+
     SECTION("discreteMomentumFields " + execName)
     {
         nf::PDESolver<NeoN::Vec3> nfUEqn(
@@ -127,7 +220,7 @@ TEST_CASE("PressureVelocityCoupling")
             nfUEqn.assemble();
             auto nfrAU = nf::computeRAU(nfUEqn);
 
-            FoamAdapter::compare(nfrAU, forAU, ApproxScalar(1e-15), false);
+            FoamAdapter::compare(*nfrAU, forAU, ApproxScalar(1e-15), false);
         }
 
         SECTION("rAU modified U")
@@ -141,7 +234,7 @@ TEST_CASE("PressureVelocityCoupling")
             nfUEqn.assemble();
             auto nfrAU = nf::computeRAU(nfUEqn);
 
-            FoamAdapter::compare(nfrAU, forAU, ApproxScalar(1e-15), false);
+            FoamAdapter::compare(*nfrAU, forAU, ApproxScalar(1e-15), false);
         }
 
         SECTION("HbyA")
@@ -151,7 +244,7 @@ TEST_CASE("PressureVelocityCoupling")
 
             nfUEqn.assemble();
             auto [nfrAU, nfHbyA] = nf::computeRAUandHByA(nfUEqn);
-            auto hostnfHbyA = nfHbyA.internalVector().copyToHost();
+            auto hostnfHbyA = nfHbyA->internalVector().copyToHost();
 
             for (size_t celli = 0; celli < hostnfHbyA.size(); celli++)
             {
@@ -166,18 +259,18 @@ TEST_CASE("PressureVelocityCoupling")
                     "ofConstrainHbyA",
                     Foam::constrainHbyA(forAU * ofUEqn.H(), ofU, ofp)
                 );
-                nf::constrainHbyA(nfU, nfp, nfHbyA);
-                auto hostBCnfHbyA = nfHbyA.boundaryData().value().copyToHost();
+                nf::constrainHbyA(nfU, nfp, *nfHbyA);
+                auto hostBCnfHbyA = nfHbyA->boundaryData().value().copyToHost();
 
                 forAll(ofConstrainHbyA.boundaryField(), patchi)
                 {
                     REQUIRE(
                         ofConstrainHbyA.boundaryField()[patchi].size()
-                        == nfHbyA.boundaryData().nBoundaryFaces(patchi)
+                        == nfHbyA->boundaryData().nBoundaryFaces(patchi)
                     );
                     const Foam::fvPatchVectorField& ofConstrainHbyAPatch =
                         ofConstrainHbyA.boundaryField()[patchi];
-                    auto [start, end] = nfHbyA.boundaryData().range(patchi);
+                    auto [start, end] = nfHbyA->boundaryData().range(patchi);
 
                     forAll(ofConstrainHbyAPatch, bfacei)
                     {
@@ -209,7 +302,7 @@ TEST_CASE("PressureVelocityCoupling")
             nfU.correctBoundaryConditions();
             nfUEqn.assemble();
             auto [nfrAU, nfHbyA] = nf::computeRAUandHByA(nfUEqn);
-            auto hostnfHbyA = nfHbyA.internalVector().copyToHost();
+            auto hostnfHbyA = nfHbyA->internalVector().copyToHost();
 
             for (size_t celli = 0; celli < hostnfHbyA.size(); celli++)
             {
@@ -219,6 +312,86 @@ TEST_CASE("PressureVelocityCoupling")
             }
         }
 
+        SECTION("structure of arrays")
+        {
+            auto requireEqual =
+                [](const NeoN::Vector<NeoN::Vec3>& a, const NeoN::Vector<NeoN::Vec3>& b)
+            {
+                auto aHost = a.copyToHost();
+                auto bHost = b.copyToHost();
+                REQUIRE(aHost.size() == bHost.size());
+                for (size_t i = 0; i < aHost.size(); i++)
+                {
+                    for (int cmpt = 0; cmpt < 3; cmpt++)
+                    {
+                        REQUIRE(
+                            aHost.view()[i][cmpt]
+                            == Catch::Approx(bHost.view()[i][cmpt]).margin(1e-12)
+                        );
+                    }
+                }
+            };
+
+            nfUEqn.assemble();
+            auto [nfrAU, nfHbyA] = nf::computeRAUandHByA(nfUEqn);
+            nf::constrainHbyA(nfU, nfp, *nfHbyA);
+
+            nf::SoAVolumeField soaHbyA(rt.nfMesh, "soaHbyA");
+            auto soarAU = nf::computeRAUandHByA(nfUEqn, soaHbyA);
+            nf::constrainHbyA(nfU, nfp, soaHbyA);
+
+            requireEqual(soaHbyA.internalVector().toAoS(), nfHbyA->internalVector());
+            requireEqual(soaHbyA.boundaryValue().toAoS(), nfHbyA->boundaryData().value());
+
+            SECTION("flux")
+            {
+                auto aosPhi = nf::flux(*nfHbyA, mesh).internalVector().copyToHost();
+                auto soaPhi = nf::flux(soaHbyA, mesh).internalVector().copyToHost();
+                REQUIRE(aosPhi.size() == soaPhi.size());
+                for (size_t facei = 0; facei < aosPhi.size(); facei++)
+                {
+                    REQUIRE(
+                        soaPhi.view()[facei] == Catch::Approx(aosPhi.view()[facei]).margin(1e-12)
+                    );
+                }
+            }
+
+            SECTION("single precision geometry")
+            {
+                auto soaPhi = nf::flux(soaHbyA, mesh).internalVector().copyToHost();
+                mesh.setSinglePrecisionGeometry(true);
+                auto floatPhi = nf::flux(soaHbyA, mesh).internalVector().copyToHost();
+                mesh.setSinglePrecisionGeometry(false);
+                REQUIRE(floatPhi.size() == soaPhi.size());
+                for (size_t facei = 0; facei < soaPhi.size(); facei++)
+                {
+                    REQUIRE(
+                        floatPhi.view()[facei]
+                        == Catch::Approx(soaPhi.view()[facei]).epsilon(1e-6).margin(1e-12)
+                    );
+                }
+            }
+
+            SECTION("updateVelocity")
+            {
+                auto aosU = nfU;
+                auto soaU = nfU;
+                nf::updateVelocity(*nfHbyA, *nfrAU, nfp, aosU);
+                nf::updateVelocity(soaHbyA, *soarAU, nfp, mesh, soaU);
+                requireEqual(soaU.internalVector(), aosU.internalVector());
+            }
+
+            SECTION("round trip")
+            {
+                nf::SoAVolumeField soaU(nfU);
+                auto copyU = nfU;
+                NeoN::fill(copyU.internalVector(), NeoN::Vec3(0.0, 0.0, 0.0));
+                soaU.copyTo(copyU);
+                requireEqual(copyU.internalVector(), nfU.internalVector());
+                requireEqual(copyU.boundaryData().value(), nfU.boundaryData().value());
+            }
+        }
+
         SECTION("matrix flux")
         {
             // create rAUf
@@ -89,3 +89,32 @@ TEST_CASE("read testDictionary from disk")
     REQUIRE(nfSubDict.get<NeoN::Vec3>("subVector") == NeoN::Vec3(5.0, 6.0, 7.0));
     REQUIRE(nfSubDict.get<std::string>("subWord") == "subWord");
 }
+
+
+TEST_CASE("read executor settings")
+{
+    SECTION("executor name")
+    {
+        Foam::dictionary controlDict;
+        controlDict.add("executor", "CPU");
+
+        auto settings = FoamAdapter::readExecutorSettings(controlDict);
+        REQUIRE(settings.type == "CPU");
+        REQUIRE(settings.numThreads == 0);
+        REQUIRE(settings.device == -1);
+    }
+
+    SECTION("executor subdictionary")
+    {
+        Foam::dictionary executor;
+        executor.add("type", "CPU");
+        executor.add("numThreads", 4);
+        Foam::dictionary controlDict;
+        controlDict.add("executor", executor);
+
+        auto settings = FoamAdapter::readExecutorSettings(controlDict);
+        REQUIRE(settings.type == "CPU");
+        REQUIRE(settings.numThreads == 4);
+        REQUIRE(settings.device == -1);
+    }
+}
@@ -158,6 +158,56 @@ TEST_CASE("UnstructuredMesh")
             allPatchesMatch(ofBMesh, nfBMesh, [](const auto& p) { return p.deltaCoeffs(); })
         );
     }
+
+    SECTION("Connectivity on " + execName)
+    {
+        const auto& conn = meshPtr->connectivity();
+        auto ownerHost = conn.faceOwner.copyToHost();
+        auto neighbourHost = conn.faceNeighbour.copyToHost();
+        auto faceCellsHost = conn.faceCells.copyToHost();
+        auto nfFaceCellsHost = nfMesh.boundaryMesh().faceCells().copyToHost();
+
+        REQUIRE(ownerHost.size() == ofMesh.faceOwner().size());
+        REQUIRE(neighbourHost.size() == ofMesh.faceNeighbour().size());
+        REQUIRE(faceCellsHost.size() == nfFaceCellsHost.size());
+        forAll(ofMesh.faceOwner(), facei)
+        {
+            REQUIRE(ownerHost.view()[facei] == ofMesh.faceOwner()[facei]);
+        }
+        forAll(ofMesh.faceNeighbour(), facei)
+        {
+            REQUIRE(neighbourHost.view()[facei] == ofMesh.faceNeighbour()[facei]);
+        }
+        for (std::size_t bfacei = 0; bfacei < faceCellsHost.size(); bfacei++)
+        {
+            REQUIRE(faceCellsHost.view()[bfacei] == nfFaceCellsHost.view()[bfacei]);
+        }
+    }
+}
+
+
+TEST_CASE("ProcessorInterfaces")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto meshPtr = createMesh(exec, *timePtr);
+    const auto& interfaces = meshPtr->processorInterfaces();
+
+    // the test mesh is not decomposed
+    REQUIRE(interfaces.empty());
+    REQUIRE(interfaces.nFaces() == 0);
+    for (NeoN::label patchi = 0; patchi < meshPtr->boundary().size(); patchi++)
+    {
+        REQUIRE_FALSE(interfaces.isProcessorPatch(patchi));
+    }
+
+    // the exchange is a no-op for serial runs
+    auto ofT = randomScalarField(*timePtr, *meshPtr, "T");
+    auto nfT = constructFrom(exec, meshPtr->nfMesh(), ofT);
+    auto before = nfT.boundaryData().value().copyToHost();
+    exchangeHalo(nfT, *meshPtr);
+    auto after = nfT.boundaryData().value().copyToHost();
+    REQUIRE(after.view()[0] == before.view()[0]);
 }
 
 